@@ -5,133 +5,1071 @@
 
 #include <AppLauncherImpl.h>
 #include <systemd_manager.h>
+#include <probes.h>
 
 using grpc::StatusCode;
-using automotivegradelinux::AppStatus;
+using automotivegradelinux::AppState;
+using automotivegradelinux::FailureReason;
 
+// The proto enums mirror the C ones, with an additional "unspecified"
+// state as required by proto3.
+static_assert(automotivegradelinux::APP_STATE_INACTIVE == APP_STATUS_INACTIVE + 1 &&
+	      automotivegradelinux::APP_STATE_STARTING == APP_STATUS_STARTING + 1 &&
+	      automotivegradelinux::APP_STATE_RUNNING == APP_STATUS_RUNNING + 1 &&
+	      automotivegradelinux::APP_STATE_STOPPING == APP_STATUS_STOPPING + 1 &&
+	      automotivegradelinux::APP_STATE_FAILED == APP_STATUS_FAILED + 1,
+	      "AppState does not match AppStatus");
+static_assert(int(automotivegradelinux::FAILURE_REASON_NONE) == APP_FAILURE_NONE &&
+	      int(automotivegradelinux::FAILURE_REASON_START_REQUEST) == APP_FAILURE_START_REQUEST &&
+	      int(automotivegradelinux::FAILURE_REASON_EXIT_CODE) == APP_FAILURE_EXIT_CODE &&
+	      int(automotivegradelinux::FAILURE_REASON_SIGNAL) == APP_FAILURE_SIGNAL &&
+	      int(automotivegradelinux::FAILURE_REASON_CORE_DUMP) == APP_FAILURE_CORE_DUMP &&
+	      int(automotivegradelinux::FAILURE_REASON_TIMEOUT) == APP_FAILURE_TIMEOUT &&
+	      int(automotivegradelinux::FAILURE_REASON_WATCHDOG) == APP_FAILURE_WATCHDOG &&
+	      int(automotivegradelinux::FAILURE_REASON_START_LIMIT) == APP_FAILURE_START_LIMIT &&
+	      int(automotivegradelinux::FAILURE_REASON_RESOURCES) == APP_FAILURE_RESOURCES &&
+	      int(automotivegradelinux::FAILURE_REASON_OOM_KILL) == APP_FAILURE_OOM_KILL &&
+	      int(automotivegradelinux::FAILURE_REASON_UNKNOWN) == APP_FAILURE_UNKNOWN,
+	      "FailureReason does not match AppFailureReason");
 
-AppLauncherImpl::AppLauncherImpl(SystemdManager *manager) :
-	m_manager(manager)
+// Shared by all the event streams
+static Metric *dropped_events_metric()
 {
-	systemd_manager_connect_callbacks(m_manager,
-					  G_CALLBACK(started_cb),
-					  G_CALLBACK(terminated_cb),
-					  this);
+	static Metric *metric = metrics_counter("applaunchd_events_dropped", NULL,
+						"Events dropped because of a full subscriber queue");
+
+	return metric;
+}
+
+// Status strings sent to clients predating the AppState enum, matching the
+// "started" and "terminated" D-Bus signals, empty for the other changes
+static const char *legacy_status(AppNotify notify)
+{
+	switch (notify) {
+	case APP_NOTIFY_STARTED:
+		return "started";
+	case APP_NOTIFY_TERMINATED:
+		return "terminated";
+	default:
+		return "";
+	}
+}
+
+
+AppLauncherImpl::AppLauncherImpl(SystemdManager *manager,
+				 size_t queue_size,
+				 OverflowPolicy overflow,
+				 size_t replay_size) :
+	m_manager(manager),
+	m_queue_size(std::max<size_t>(queue_size, 1)),
+	m_overflow(overflow),
+	m_clients(std::make_unique<const ClientIndex>()),
+	m_replay_size(replay_size)
+{
+	// Seed the status table with the known applications
+	auto status_table = std::make_shared<StatusTable>();
+	GList *apps = m_manager ? systemd_manager_get_app_list(m_manager) : NULL;
+	for (GList *l = apps; l; l = l->next) {
+		struct _AppInfo *app_info = (struct _AppInfo*) l->data;
+		const char *id = app_info_get_app_id(app_info);
+		auto &app_status = (*status_table)[id];
+		AppStatus status = app_info_get_status(app_info);
+		AppState state = static_cast<AppState>(status + 1);
+
+		app_status.set_id(id);
+		app_status.set_status(legacy_status(app_state_notification(APP_STATUS_INACTIVE,
+									   status)));
+		app_status.set_state(state);
+		app_status.set_reason(static_cast<FailureReason>(app_info_get_failure_reason(app_info)));
+	}
+	m_status_table = std::move(status_table);
+
+	m_metrics.subscribers = metrics_gauge("applaunchd_status_subscribers", NULL,
+					      "GetStatusEvents subscribers");
+	m_metrics.watchers = metrics_gauge("applaunchd_catalog_watchers", NULL,
+					   "WatchApplications subscribers");
+	m_metrics.events = metrics_counter("applaunchd_status_events", NULL,
+					   "Status events dispatched");
+	m_metrics.fanout = metrics_histogram("applaunchd_status_fanout_duration_microseconds", NULL,
+					     "Time to queue a status event for every subscriber");
+
+	metrics_add_collector(collect_subscriber_metrics_cb, this);
+
+	// StartApplication messages live on a per-call arena
+	SetMessageAllocatorFor_StartApplication(&m_start_allocator);
+
+	if (m_manager) {
+		systemd_manager_connect_status_callback(m_manager,
+							G_CALLBACK(status_changed_cb),
+							this);
+		systemd_manager_connect_catalog_callback(m_manager,
+							 G_CALLBACK(catalog_changed_cb),
+							 this);
+		UpdateCatalog();
+	}
+}
+
+AppLauncherImpl::~AppLauncherImpl()
+{
+	metrics_remove_collector(collect_subscriber_metrics_cb, this);
+}
+
+// Finish a unary call
+static void FinishCall(ServerUnaryReactor *reactor, const char *method, const Status &status)
+{
+	APPLAUNCHD_PROBE2(rpc__exit, method, status.error_code());
+	reactor->Finish(status);
+}
+
+// Helpers for the raw methods
+template <class Message>
+static bool ParseRequest(const grpc::ByteBuffer *request, Message *message)
+{
+	// Deserializing consumes the buffer, work on a (shallow) copy
+	grpc::ByteBuffer buffer(*request);
+
+	return grpc::SerializationTraits<Message>::Deserialize(&buffer, message).ok();
+}
+
+template <class Message>
+static bool Serialize(const Message &message, grpc::ByteBuffer *buffer)
+{
+	bool own_buffer;
+
+	return grpc::SerializationTraits<Message>::Serialize(message, buffer, &own_buffer).ok();
+}
+
+ServerUnaryReactor* AppLauncherImpl::StartApplication(CallbackServerContext* context,
+						      const StartRequest* request,
+						      StartResponse* response)
+{
+	ServerUnaryReactor* reactor = context->DefaultReactor();
+	APPLAUNCHD_PROBE1(rpc__entry, "StartApplication");
+	gint64 received = g_get_monotonic_time();
+
+	if (!m_manager) {
+		FinishCall(reactor, "StartApplication",
+			   Status(StatusCode::INTERNAL, "Initialization failed"));
+		return reactor;
+	}
+
+	// Unknown applications can be rejected without involving the main loop
+	auto catalog = GetCatalog();
+	if (catalog && !catalog->Find(request->id())) {
+		FinishCall(reactor, "StartApplication",
+			   Status(StatusCode::INVALID_ARGUMENT,
+				  "Unknown application '" + request->id() + "'"));
+		return reactor;
+	}
+
+	// The request and response stay valid until the reactor is finished,
+	// which is done from the main loop once systemd has been asked
+	bool posted = Post([this, reactor, request, response, received]() {
+		// Search the apps list for the given app-id
+		std::string app_id = request->id();
+		auto dbus_launcher_info = systemd_manager_get_app_info(m_manager, app_id.c_str());
+		if (!dbus_launcher_info) {
+			std::string error("Unknown application '");
+			error += app_id;
+			error += "'";
+			FinishCall(reactor, "StartApplication", Status(StatusCode::INVALID_ARGUMENT, error));
+			return;
+		}
+
+		gboolean status = systemd_manager_start_app_full(m_manager, dbus_launcher_info,
+								 received);
+		response->set_status(status);
+		if (!status) {
+			// Maybe just return StatusCode::NOT_FOUND instead?
+			std::string error("Failed to start application '");
+			error += app_id;
+			error += "'";
+			response->set_message(error);
+		}
+
+		FinishCall(reactor, "StartApplication", Status::OK);
+	});
+	if (!posted)
+		FinishCall(reactor, "StartApplication",
+			   Status(StatusCode::UNAVAILABLE, "Shutting down"));
+
+	return reactor;
+}
+
+ServerUnaryReactor* AppLauncherImpl::GetMetrics(CallbackServerContext* context,
+						const MetricsRequest* request,
+						MetricsResponse* response)
+{
+	ServerUnaryReactor* reactor = context->DefaultReactor();
+	APPLAUNCHD_PROBE1(rpc__entry, "GetMetrics");
+
+	metrics_foreach([](Metric *metric, gpointer user_data) {
+		auto response = static_cast<MetricsResponse *>(user_data);
+		auto value = response->add_metrics();
+
+		value->set_name(metric_get_name(metric));
+		if (metric_get_labels(metric))
+			value->set_labels(metric_get_labels(metric));
+		if (metric_get_help(metric))
+			value->set_help(metric_get_help(metric));
+
+		switch (metric_get_type(metric)) {
+		case METRIC_TYPE_COUNTER:
+			value->set_counter(metric_get_value(metric));
+			break;
+		case METRIC_TYPE_GAUGE:
+			value->set_gauge(metric_get_value(metric));
+			break;
+		case METRIC_TYPE_HISTOGRAM: {
+			auto snapshot = std::make_unique<MetricHistogramSnapshot>();
+			auto histogram = value->mutable_histogram();
+
+			metric_get_histogram(metric, snapshot.get());
+			histogram->set_count(snapshot->count);
+			histogram->set_sum(snapshot->sum);
+			histogram->set_max(snapshot->max);
+			histogram->set_p50(metrics_histogram_quantile(snapshot.get(), 0.5));
+			histogram->set_p90(metrics_histogram_quantile(snapshot.get(), 0.9));
+			histogram->set_p99(metrics_histogram_quantile(snapshot.get(), 0.99));
+			for (guint i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+				if (!snapshot->buckets[i])
+					continue;
+				auto bucket = histogram->add_buckets();
+				bucket->set_upper_bound(metrics_histogram_bucket_upper_bound(i));
+				bucket->set_count(snapshot->buckets[i]);
+			}
+			break;
+		}
+		}
+	}, response);
+
+	if (request->openmetrics()) {
+		gchar *text = metrics_to_openmetrics();
+		response->set_openmetrics(text);
+		g_free(text);
+	}
+
+	FinishCall(reactor, "GetMetrics", Status::OK);
+	return reactor;
+}
+
+ServerUnaryReactor* AppLauncherImpl::GetLaunchTrace(CallbackServerContext* context,
+						    const LaunchTraceRequest* request,
+						    LaunchTraceResponse* response)
+{
+	ServerUnaryReactor* reactor = context->DefaultReactor();
+	APPLAUNCHD_PROBE1(rpc__entry, "GetLaunchTrace");
+
+	gchar *json = launch_trace_to_json();
+	response->set_json(json);
+	g_free(json);
+
+	FinishCall(reactor, "GetLaunchTrace", Status::OK);
+	return reactor;
+}
+
+bool AppLauncherImpl::Post(std::function<void()> command)
+{
+	const std::lock_guard<std::mutex> lock(m_post_mutex);
+	if (m_done)
+		return false;
+
+	auto data = new std::function<void()>(std::move(command));
+
+	systemd_manager_invoke(m_manager,
+			       [](gpointer data) -> gboolean {
+				       (*static_cast<std::function<void()> *>(data))();
+				       return G_SOURCE_REMOVE;
+			       },
+			       data,
+			       [](gpointer data) {
+				       delete static_cast<std::function<void()> *>(data);
+			       });
+	return true;
 }
 
-Status AppLauncherImpl::StartApplication(ServerContext* context,
-					 const StartRequest* request,
-					 StartResponse* response)
+ServerUnaryReactor* AppLauncherImpl::ListApplications(CallbackServerContext* context,
+						      const grpc::ByteBuffer* request,
+						      grpc::ByteBuffer* response)
 {
-	if (!m_manager)
-		return Status(StatusCode::INTERNAL, "Initialization failed");
+	ServerUnaryReactor* reactor = context->DefaultReactor();
+	APPLAUNCHD_PROBE1(rpc__entry, "ListApplications");
+
+	auto catalog = GetCatalog();
+	if (!catalog) {
+		FinishCall(reactor, "ListApplications",
+			   Status(StatusCode::INTERNAL, "Initialization failed"));
+		return reactor;
+	}
+
+	// The request and reply only live for this call, keep them on an arena
+	InlineArena<1024> arena;
+
+	ListRequest &list_request = *arena.Create<ListRequest>();
+	if (!ParseRequest(request, &list_request)) {
+		FinishCall(reactor, "ListApplications",
+			   Status(StatusCode::INVALID_ARGUMENT, "Malformed request"));
+		return reactor;
+	}
+
+	const ListResponse &list = catalog->list;
+	ListResponse &partial = *arena.Create<ListResponse>();
+	partial.set_version(list.version());
+
+	if (list_request.known_version() &&
+	    list_request.known_version() == list.version()) {
+		partial.set_not_modified(true);
+		Serialize(partial, response);
+		FinishCall(reactor, "ListApplications", Status::OK);
+		return reactor;
+	}
+
+	// Plain full listing, only references the cached slices
+	if (!list_request.has_field_mask() && !list_request.page_size() &&
+	    list_request.page_token().empty() && !list_request.graphical()) {
+		*response = catalog->buffer;
+		FinishCall(reactor, "ListApplications", Status::OK);
+		return reactor;
+	}
+
+	bool want_name = true, want_icon_path = true;
+	if (list_request.has_field_mask()) {
+		want_name = want_icon_path = false;
+		for (auto &path : list_request.field_mask().paths()) {
+			if (path == "name") {
+				want_name = true;
+			} else if (path == "icon_path") {
+				want_icon_path = true;
+			} else if (path != "id") {
+				FinishCall(reactor, "ListApplications",
+					   Status(StatusCode::INVALID_ARGUMENT,
+						  "Unknown field '" + path + "'"));
+				return reactor;
+			}
+		}
+	}
 
-	// Search the apps list for the given app-id
-	std::string app_id = request->id();
-	auto dbus_launcher_info = systemd_manager_get_app_info(m_manager, app_id.c_str());
-	if (!dbus_launcher_info) {
-		std::string error("Unknown application '");
-		error += app_id;
-		error += "'";
-		return Status(StatusCode::INVALID_ARGUMENT, error);
+	// Page tokens are "<version>:<offset>", only valid for the catalog
+	// version they were issued for
+	guint64 offset = 0;
+	if (!list_request.page_token().empty()) {
+		const std::string &token = list_request.page_token();
+		size_t colon = token.find(':');
+		guint64 version;
+		if (colon == std::string::npos ||
+		    !g_ascii_string_to_unsigned(token.substr(0, colon).c_str(), 10, 0, G_MAXUINT64,
+						&version, NULL) ||
+		    !g_ascii_string_to_unsigned(token.c_str() + colon + 1, 10, 0, G_MAXINT,
+						&offset, NULL)) {
+			FinishCall(reactor, "ListApplications",
+				   Status(StatusCode::INVALID_ARGUMENT, "Invalid page token"));
+			return reactor;
+		}
+		if (version != list.version()) {
+			FinishCall(reactor, "ListApplications",
+				   Status(StatusCode::ABORTED,
+					  "Applications list changed, restart listing"));
+			return reactor;
+		}
+		if (offset > (guint64) list.apps_size()) {
+			FinishCall(reactor, "ListApplications",
+				   Status(StatusCode::INVALID_ARGUMENT, "Invalid page token"));
+			return reactor;
+		}
 	}
 
-	gboolean status = systemd_manager_start_app(m_manager, dbus_launcher_info);
-	response->set_status(status);
-	if (!status) {
-		// Maybe just return StatusCode::NOT_FOUND instead?
-		std::string error("Failed to start application '");
-		error += app_id;
-		error += "'";
-		response->set_message(error);
+	// A full page stops at the next application to list, if any, so that
+	// the last page never comes with a token leading to an empty one
+	int i;
+	for (i = offset; i < list.apps_size(); i++) {
+		const automotivegradelinux::AppInfo &app = list.apps(i);
+		if (list_request.graphical() && app.icon_path().empty())
+			continue;
+
+		if (list_request.page_size() &&
+		    partial.apps_size() == (int) list_request.page_size())
+			break;
+
+		auto info = partial.add_apps();
+		info->set_id(app.id());
+		if (want_name)
+			info->set_name(app.name());
+		if (want_icon_path)
+			info->set_icon_path(app.icon_path());
 	}
+	if (i < list.apps_size())
+		partial.set_next_page_token(std::to_string(list.version()) + ":" + std::to_string(i));
 
-	return Status::OK;
+	Serialize(partial, response);
+	FinishCall(reactor, "ListApplications", Status::OK);
+	return reactor;
 }
 
-Status AppLauncherImpl::ListApplications(ServerContext* context,
-					 const ListRequest* request,
-					 ListResponse* response)
+const automotivegradelinux::AppInfo *AppLauncherImpl::Catalog::Find(const std::string &id) const
 {
-	if (!m_manager)
-		return Status(StatusCode::INTERNAL, "Initialization failed");
+	auto it = index.find(id);
 
-	GList *apps = systemd_manager_get_app_list(m_manager);
-	if (!apps)
-		return Status::OK; // Perhaps return failure here?
+	return it != index.end() ? &list.apps(it->second) : nullptr;
+}
 
-	guint len = g_list_length(apps);
-	for (guint i = 0; i < len; i++) {
-		struct _AppInfo *app_info = (struct _AppInfo*) g_list_nth_data(apps, i);
-		auto info = response->add_apps();
+void AppLauncherImpl::UpdateCatalog()
+{
+	auto catalog = std::make_shared<Catalog>();
+	ListResponse &response = catalog->list;
+
+	for (GList *l = systemd_manager_get_app_list(m_manager); l; l = l->next) {
+		struct _AppInfo *app_info = (struct _AppInfo*) l->data;
+		auto info = response.add_apps();
 		info->set_id(app_info_get_app_id(app_info));
 		info->set_name(app_info_get_name(app_info));
 		info->set_icon_path(app_info_get_icon_path(app_info));
+		catalog->index[info->id()] = response.apps_size() - 1;
+	}
+	response.set_version(systemd_manager_get_catalog_version(m_manager));
+
+	if (!Serialize(response, &catalog->buffer)) {
+		std::cerr << "Failed to serialize applications list" << std::endl;
+		return;
+	}
+
+	const std::lock_guard<std::mutex> lock(m_watch_mutex);
+
+	auto old_catalog = GetCatalog();
+	std::atomic_store(&m_catalog, std::shared_ptr<const Catalog>(catalog));
+	APPLAUNCHD_PROBE2(catalog__publish, response.version(), response.apps_size());
+
+	if (!old_catalog || m_watchers.empty())
+		return;
+
+	// Diff consecutive catalogs by application id
+	CatalogUpdate update;
+	update.set_version(response.version());
+
+	for (auto &app : response.apps()) {
+		auto old_app = old_catalog->Find(app.id());
+		if (!old_app)
+			*update.add_added() = app;
+		else if (app.name() != old_app->name() ||
+			 app.icon_path() != old_app->icon_path())
+			*update.add_changed() = app;
+	}
+	for (auto &app : old_catalog->list.apps()) {
+		if (!catalog->Find(app.id()))
+			update.add_removed(app.id());
+	}
+
+	if (!update.added_size() && !update.changed_size() && !update.removed_size())
+		return;
+
+	grpc::ByteBuffer buffer;
+	if (!Serialize(update, &buffer)) {
+		std::cerr << "Failed to serialize catalog update" << std::endl;
+		return;
+	}
+
+	for (auto &watcher : m_watchers)
+		watcher->Send(buffer);
+}
+
+ServerWriteReactor<grpc::ByteBuffer>* AppLauncherImpl::GetStatusEvents(CallbackServerContext* context,
+								       const grpc::ByteBuffer* request)
+{
+	APPLAUNCHD_PROBE1(rpc__entry, "GetStatusEvents");
+
+	StatusRequest status_request;
+	bool valid = ParseRequest(request, &status_request);
+
+	StatusFilter filter;
+	filter.app_ids.insert(status_request.app_ids().begin(),
+			      status_request.app_ids().end());
+	for (auto state : status_request.states()) {
+		if (state < 0 || state > automotivegradelinux::AppState_MAX)
+			valid = false;
+		else
+			filter.states |= 1u << state;
+	}
+
+	auto client = std::make_shared<StatusEventsReactor>(this, context->peer(), filter,
+							    status_request.conflate());
+
+	// Keeps the reactor alive until OnDone, snapshots of the subscriber
+	// list may hold further references
+	client->m_self = client;
+
+	if (!valid) {
+		client->Close(Status(StatusCode::INVALID_ARGUMENT, "Malformed request"));
+		return client.get();
 	}
 
-	return Status::OK;
+	// Save client information, the reactor removes itself in OnDone
+	AddClient(client, status_request.resume_after_seq());
+
+	return client.get();
 }
 
-Status AppLauncherImpl::GetStatusEvents(ServerContext* context,
-					const StatusRequest* request,
-					ServerWriter<StatusResponse>* writer)
+ServerWriteReactor<grpc::ByteBuffer>* AppLauncherImpl::WatchApplications(CallbackServerContext* context,
+									 const grpc::ByteBuffer* request)
 {
+	APPLAUNCHD_PROBE1(rpc__entry, "WatchApplications");
+
+	WatchRequest watch_request;
 
-	// Save client information
-	m_clients_mutex.lock();
-	m_clients.push_back(std::pair(context, writer));
-	m_clients_mutex.unlock();
+	auto watcher = std::make_shared<CatalogWatchReactor>(this, context->peer());
+	watcher->m_self = watcher;
 
-	// For now block until client disconnect / server shutdown
-	// A switch to the async or callback server APIs might be more elegant than
-        // holding the thread like this, and may be worth investigating at some point.
-	std::unique_lock lock(m_done_mutex);
-	m_done_cv.wait(lock, [context, this]{ return (context->IsCancelled() || m_done); });
+	if (!ParseRequest(request, &watch_request)) {
+		watcher->Close(Status(StatusCode::INVALID_ARGUMENT, "Malformed request"));
+		return watcher.get();
+	}
 
-	return Status::OK;
+	AddWatcher(watcher);
+
+	return watcher.get();
 }
 
+void AppLauncherImpl::AddWatcher(std::shared_ptr<CatalogWatchReactor> watcher)
+{
+	const std::lock_guard<std::mutex> lock(m_watch_mutex);
+
+	auto catalog = GetCatalog();
+	if (!catalog) {
+		watcher->Close(Status(StatusCode::INTERNAL, "Initialization failed"));
+		return;
+	}
+	if (m_done) {
+		watcher->Close(Status(StatusCode::UNAVAILABLE, "Shutting down"));
+		return;
+	}
 
-void AppLauncherImpl::SendStatus(std::string id, std::string status)
+	CatalogUpdate update;
+	update.set_version(catalog->list.version());
+	update.set_snapshot(true);
+	*update.mutable_added() = catalog->list.apps();
+
+	grpc::ByteBuffer buffer;
+	if (!Serialize(update, &buffer)) {
+		watcher->Close(Status(StatusCode::INTERNAL, "Failed to serialize catalog"));
+		return;
+	}
+	watcher->Send(buffer);
+
+	m_watchers.push_back(watcher);
+	metric_set(m_metrics.watchers, m_watchers.size());
+}
+
+void AppLauncherImpl::RemoveWatcher(CatalogWatchReactor *watcher)
 {
-	const std::lock_guard<std::mutex> lock(m_clients_mutex);
+	const std::lock_guard<std::mutex> lock(m_watch_mutex);
+
+	for (auto it = m_watchers.begin(); it != m_watchers.end(); ++it) {
+		if (it->get() == watcher) {
+			m_watchers.erase(it);
+			metric_set(m_metrics.watchers, m_watchers.size());
+			break;
+		}
+	}
+}
+
+void AppLauncherImpl::AddClient(std::shared_ptr<StatusEventsReactor> client,
+				uint64_t resume_after_seq)
+{
+	const std::lock_guard<std::mutex> history_lock(m_history_mutex);
+
+	if (resume_after_seq) {
+		// The sequence restarts along with the daemon unless its state
+		// was handed over, a client ahead of us needs a snapshot too
+		bool replayable = resume_after_seq <= m_seq &&
+			(resume_after_seq == m_seq ||
+			 (!m_history.empty() && m_history.front().seq <= resume_after_seq + 1));
 
-	if (m_clients.empty())
+		if (replayable) {
+			for (auto &entry : m_history) {
+				if (entry.seq > resume_after_seq &&
+				    client->m_filter.Matches(entry.id, entry.state))
+					client->Replay(entry.event);
+			}
+		} else {
+			client->Replay(BuildSnapshot(client->m_filter));
+		}
+	}
+	client->SetPosition(m_seq);
+
+	const std::lock_guard<std::mutex> lock(m_clients_mutex);
+	if (m_done) {
+		client->Close(Status(StatusCode::UNAVAILABLE, "Shutting down"));
 		return;
+	}
+
+	auto clients = std::make_unique<ClientIndex>(m_clients.Current());
+	clients->Add(client);
+	metric_set(m_metrics.subscribers, clients->all.size());
+	m_clients.Publish(std::move(clients));
+}
 
+void AppLauncherImpl::ClientIndex::Add(const std::shared_ptr<StatusEventsReactor> &client)
+{
+	all.push_back(client);
+	if (client->m_filter.app_ids.empty()) {
+		any_app.push_back(client);
+	} else {
+		for (auto &id : client->m_filter.app_ids)
+			by_app[id].push_back(client);
+	}
+}
+
+grpc::ByteBuffer AppLauncherImpl::BuildSnapshot(const StatusFilter &filter)
+{
 	StatusResponse response;
+	auto snapshot = response.mutable_snapshot();
+	for (auto &app_status : *GetStatusTable()) {
+		if (filter.app_ids.empty() || filter.app_ids.count(app_status.first))
+			*snapshot->add_apps() = app_status.second;
+	}
+	response.set_seq(m_seq);
+	response.set_timestamp_us(g_get_monotonic_time());
+
+	grpc::ByteBuffer buffer;
+	Serialize(response, &buffer);
+
+	return buffer;
+}
+
+void AppLauncherImpl::RemoveClient(StatusEventsReactor *client)
+{
+	const std::lock_guard<std::mutex> lock(m_clients_mutex);
+
+	auto clients = std::make_unique<ClientIndex>();
+	for (auto &c : m_clients.Current().all) {
+		if (c.get() != client)
+			clients->Add(c);
+	}
+	metric_set(m_metrics.subscribers, clients->all.size());
+	m_clients.Publish(std::move(clients));
+}
+
+std::vector<SubscriberStats> AppLauncherImpl::GetSubscriberStats()
+{
+	auto clients = m_clients.Read();
+
+	std::vector<SubscriberStats> stats;
+	for (auto &client : clients->all)
+		stats.push_back(client->GetStats());
+
+	return stats;
+}
+
+void AppLauncherImpl::collect_subscriber_metrics_cb(GPtrArray *metrics,
+						    gpointer user_data)
+{
+	auto self = static_cast<AppLauncherImpl *>(user_data);
+
+	// Streams of a same peer, e.g. any local client for "unix:", are
+	// summed up so that each label set is only exported once
+	std::map<std::string, SubscriberStats> peers;
+	for (auto &stats : self->GetSubscriberStats()) {
+		auto &peer = peers[stats.peer];
+		peer.queue_depth += stats.queue_depth;
+		peer.dropped += stats.dropped;
+	}
+
+	for (auto &peer : peers) {
+		gchar *label = metrics_format_label("peer", peer.first.c_str());
+
+		metrics_collected_add(metrics, METRIC_TYPE_GAUGE,
+				      "applaunchd_subscriber_queue_depth", label,
+				      "Events queued for a subscriber peer",
+				      peer.second.queue_depth);
+		metrics_collected_add(metrics, METRIC_TYPE_COUNTER,
+				      "applaunchd_subscriber_events_dropped", label,
+				      "Events dropped for a subscriber peer, while connected",
+				      peer.second.dropped);
+		g_free(label);
+	}
+}
+
+void AppLauncherImpl::Shutdown()
+{
+	{
+		// Commands queued up to now are left for the caller to run
+		const std::lock_guard<std::mutex> lock(m_post_mutex);
+		m_done = true;
+	}
+
+	const std::lock_guard<std::mutex> lock(m_clients_mutex);
+	for (auto &client : m_clients.Current().all)
+		client->Close(Status::OK);
+
+	const std::lock_guard<std::mutex> watch_lock(m_watch_mutex);
+	for (auto &watcher : m_watchers)
+		watcher->Close(Status::OK);
+}
+
+// Format of the saved state, see SaveState()
+#define SERVICE_STATE_TYPE "(ta(tsuay))"
+
+GVariant *AppLauncherImpl::SaveState()
+{
+	const std::lock_guard<std::mutex> lock(m_history_mutex);
+
+	GVariantBuilder history;
+	g_variant_builder_init(&history, G_VARIANT_TYPE("a(tsuay)"));
+	for (auto &entry : m_history) {
+		std::vector<grpc::Slice> slices;
+		std::string data;
+
+		entry.event.Dump(&slices);
+		for (auto &slice : slices)
+			data.append(reinterpret_cast<const char *>(slice.begin()), slice.size());
+
+		g_variant_builder_add(&history, "(tsu@ay)",
+				      (guint64) entry.seq, entry.id.c_str(), (guint32) entry.state,
+				      g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE,
+								data.data(), data.size(), 1));
+	}
+
+	return g_variant_new(SERVICE_STATE_TYPE, (guint64) m_seq, &history);
+}
+
+bool AppLauncherImpl::RestoreState(GVariant *state)
+{
+	if (!g_variant_is_of_type(state, G_VARIANT_TYPE(SERVICE_STATE_TYPE))) {
+		std::cerr << "Ignoring saved service state of type "
+			  << g_variant_get_type_string(state) << std::endl;
+		return false;
+	}
+
+	const std::lock_guard<std::mutex> lock(m_history_mutex);
+
+	guint64 seq;
+	GVariantIter *iter;
+	g_variant_get(state, SERVICE_STATE_TYPE, &seq, &iter);
+
+	m_seq = seq;
+	m_history.clear();
+
+	guint64 entry_seq;
+	const gchar *id;
+	guint32 app_state;
+	GVariant *event;
+	while (g_variant_iter_loop(iter, "(t&su@ay)", &entry_seq, &id, &app_state, &event)) {
+		if (!m_replay_size || entry_seq > seq ||
+		    !automotivegradelinux::AppState_IsValid(app_state))
+			continue;
+
+		gsize size;
+		const void *data = g_variant_get_fixed_array(event, &size, 1);
+		grpc::Slice slice(data, size);
+
+		if (m_history.size() >= m_replay_size)
+			m_history.pop_front();
+		m_history.push_back(HistoryEntry { entry_seq, id, static_cast<AppState>(app_state),
+						   grpc::ByteBuffer(&slice, 1) });
+	}
+	g_variant_iter_free(iter);
+
+	return true;
+}
+
+void AppLauncherImpl::SendStatus(const std::string &id,
+				 AppState state,
+				 FailureReason reason,
+				 AppNotify notify)
+{
+	InlineArena<512> arena;
+
+	StatusResponse &response = *arena.Create<StatusResponse>();
 	auto app_status = response.mutable_app();
 	app_status->set_id(id);
-	app_status->set_status(status);
+	app_status->set_status(legacy_status(notify));
+	app_status->set_state(state);
+	app_status->set_reason(reason);
+	response.set_timestamp_us(g_get_monotonic_time());
 
-	auto it = m_clients.begin();
-	while (it != m_clients.end()) {
-		if (it->first->IsCancelled()) {
-			// Client has gone away, remove from list
-			std::cout << "Removing cancelled RPC client!" << std::endl;
-			it = m_clients.erase(it);
+	// Serialize once, subscribers share the resulting slices
+	grpc::ByteBuffer event;
+	uint64_t seq;
+	{
+		const std::lock_guard<std::mutex> lock(m_history_mutex);
 
-			// We're not exiting, but wake up blocked client RPC handlers so
-			// the canceled one will clean exit.
-			// Note that in practice this means the client RPC handler thread
-			// sticks around until the next status event is sent.
-			m_done_cv.notify_all();
+		seq = ++m_seq;
+		response.set_seq(seq);
 
-			continue;
-		} else {
-			it->second->Write(response);
-			++it;
+		if (!Serialize(response, &event)) {
+			std::cerr << "Failed to serialize status event" << std::endl;
+			return;
+		}
+
+		// Readers keep using the table they got, publish a new one
+		auto status_table = std::make_shared<StatusTable>(*GetStatusTable());
+		(*status_table)[id] = *app_status;
+		std::atomic_store(&m_status_table, std::shared_ptr<const StatusTable>(std::move(status_table)));
+
+		if (m_replay_size) {
+			if (m_history.size() >= m_replay_size)
+				m_history.pop_front();
+			m_history.push_back(HistoryEntry { seq, id, state, event });
+		}
+	}
+
+	metric_inc(m_metrics.events);
+
+	// Dispatch works on the current snapshot, subscribers coming and going
+	// in the meantime publish a new one and wait for us, never the reverse
+	gint64 start = g_get_monotonic_time();
+	auto clients = m_clients.Read();
+	APPLAUNCHD_PROBE3(status__fanout__begin, id.c_str(), state, seq);
+
+	// Only queues the event, writes complete asynchronously
+	unsigned int sent = 0;
+	auto dispatch = [&](const ClientList &list) {
+		for (auto &client : list) {
+			if (client->m_filter.MatchesState(state)) {
+				if (APPLAUNCHD_PROBE_ENABLED(status__send))
+					APPLAUNCHD_PROBE3(status__send, client->GetPeer().c_str(),
+							  id.c_str(), seq);
+				client->Send(seq, event, *app_status);
+				sent++;
+			}
+		}
+	};
+
+	dispatch(clients->any_app);
+	auto it = clients->by_app.find(id);
+	if (it != clients->by_app.end())
+		dispatch(it->second);
+
+	APPLAUNCHD_PROBE4(status__fanout__end, id.c_str(), state, seq, sent);
+	gint64 end = g_get_monotonic_time();
+	metric_record(m_metrics.fanout, end - start);
+
+	if (state == automotivegradelinux::APP_STATE_RUNNING)
+		launch_trace_mark(id.c_str(), LAUNCH_STAGE_FANNED_OUT, end);
+}
+
+void AppLauncherImpl::HandleAppStatusChanged(const std::string &id,
+					     AppStatus status,
+					     AppFailureReason reason,
+					     AppNotify notify)
+{
+	SendStatus(id,
+		   static_cast<AppState>(status + 1),
+		   static_cast<FailureReason>(reason),
+		   notify);
+}
+
+EventStreamReactor::EventStreamReactor(const char *method,
+				       const std::string &peer,
+				       size_t queue_size,
+				       OverflowPolicy overflow) :
+	m_method(method),
+	m_peer(peer),
+	m_queue_size(queue_size),
+	m_overflow(overflow)
+{
+	// Let the client know the subscription is active right away
+	StartSendInitialMetadata();
+}
+
+void EventStreamReactor::Send(const grpc::ByteBuffer &event)
+{
+	const std::lock_guard<std::mutex> lock(m_mutex);
+
+	QueueLocked(event, true);
+}
+
+// Must be called with m_mutex held
+void EventStreamReactor::QueueLocked(const grpc::ByteBuffer &event, bool bounded)
+{
+	if (m_closing)
+		return;
+
+	if (bounded && m_queue.size() >= m_queue_size) {
+		m_dropped++;
+		metric_inc(dropped_events_metric());
+		if (m_overflow == OverflowPolicy::Disconnect) {
+			std::cout << "Disconnecting slow RPC client " << m_peer << std::endl;
+			CloseLocked(Status(StatusCode::RESOURCE_EXHAUSTED,
+					   "Too many pending events"));
+			return;
+		}
+
+		// Drop the oldest event not being written, or this one if
+		// there is no such event
+		if (m_queue.size() == 1 && m_writing)
+			return;
+		m_queue.erase(m_queue.begin() + (m_writing ? 1 : 0));
+	}
+
+	m_queue.push_back(event);
+	if (!m_writing)
+		NextWrite();
+}
+
+SubscriberStats EventStreamReactor::GetStats()
+{
+	const std::lock_guard<std::mutex> lock(m_mutex);
+
+	return SubscriberStats { m_peer, m_queue.size(), m_dropped };
+}
+
+void EventStreamReactor::Close(Status status)
+{
+	const std::lock_guard<std::mutex> lock(m_mutex);
+
+	CloseLocked(status);
+}
+
+// Must be called with m_mutex held
+void EventStreamReactor::CloseLocked(Status status)
+{
+	if (m_closing)
+		return;
+
+	m_closing = true;
+	m_status = status;
+
+	// Drop pending events, but keep the one being written alive
+	while (m_queue.size() > (m_writing ? 1 : 0))
+		m_queue.pop_back();
+	if (!m_writing)
+		NextWrite();
+}
+
+// Must be called with m_mutex held and no write in flight
+void EventStreamReactor::NextWrite()
+{
+	if (m_closing) {
+		if (!m_finished) {
+			m_finished = true;
+			Finish(m_status);
 		}
+		return;
+	}
+
+	grpc::ByteBuffer event;
+	if (m_queue.empty() && Refill(&event))
+		m_queue.push_back(std::move(event));
+
+	m_writing = !m_queue.empty();
+	if (m_writing) {
+		APPLAUNCHD_PROBE2(stream__write, m_peer.c_str(), m_queue.size());
+		StartWrite(&m_queue.front());
+	}
+}
+
+void EventStreamReactor::OnWriteDone(bool ok)
+{
+	const std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_writing = false;
+	m_queue.pop_front();
+
+	if (!ok) {
+		// The stream is broken, OnCancel will follow if the client is gone
+		m_closing = true;
+		m_queue.clear();
 	}
+
+	NextWrite();
+}
+
+void EventStreamReactor::OnCancel()
+{
+	std::cout << "Removing cancelled RPC client!" << std::endl;
+	Close(Status::CANCELLED);
+}
+
+void EventStreamReactor::OnDone()
+{
+	if (m_dropped)
+		std::cout << "RPC client " << m_peer << " dropped " << m_dropped
+			  << " events" << std::endl;
+
+	APPLAUNCHD_PROBE2(rpc__exit, m_method, m_status.error_code());
+
+	Detach();
+
+	// May delete this, unless an event dispatch still holds a reference
+	m_self.reset();
+}
+
+StatusEventsReactor::StatusEventsReactor(AppLauncherImpl *service,
+					 const std::string &peer,
+					 const StatusFilter &filter,
+					 bool conflate) :
+	EventStreamReactor("GetStatusEvents", peer, service->m_queue_size, service->m_overflow),
+	m_service(service),
+	m_filter(filter),
+	m_conflate(conflate)
+{
+}
+
+void StatusEventsReactor::Send(uint64_t seq,
+			       const grpc::ByteBuffer &event,
+			       const automotivegradelinux::AppStatus &status)
+{
+	const std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (seq <= m_last_seq)
+		return;
+	m_last_seq = seq;
+
+	// Once conflating, keep doing so until the batch is sent to preserve
+	// ordering
+	if (m_conflate && (!m_pending.empty() || QueueFullLocked())) {
+		m_pending[status.id()] = status;
+		m_pending_seq = seq;
+		return;
+	}
+
+	QueueLocked(event, true);
 }
 
-void AppLauncherImpl::HandleAppStarted(std::string id)
+// Must be called with m_mutex held
+bool StatusEventsReactor::Refill(grpc::ByteBuffer *event)
 {
-	SendStatus(id, "started");
+	if (m_pending.empty())
+		return false;
+
+	StatusResponse response;
+	auto batch = response.mutable_batch();
+	for (auto &app_status : m_pending)
+		*batch->add_apps() = app_status.second;
+	response.set_seq(m_pending_seq);
+	response.set_timestamp_us(g_get_monotonic_time());
+	m_pending.clear();
+
+	return Serialize(response, event);
 }
 
-void AppLauncherImpl::HandleAppTerminated(std::string id)
+void StatusEventsReactor::Replay(const grpc::ByteBuffer &event)
 {
-	SendStatus(id, "terminated");
+	const std::lock_guard<std::mutex> lock(m_mutex);
+
+	QueueLocked(event, false);
 }
 
+void StatusEventsReactor::SetPosition(uint64_t seq)
+{
+	const std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_last_seq = seq;
+}
+
+void StatusEventsReactor::Detach()
+{
+	m_service->RemoveClient(this);
+}
+
+CatalogWatchReactor::CatalogWatchReactor(AppLauncherImpl *service,
+					 const std::string &peer) :
+	EventStreamReactor("WatchApplications", peer, service->m_queue_size,
+			   OverflowPolicy::Disconnect),
+	m_service(service)
+{
+}
+
+void CatalogWatchReactor::Detach()
+{
+	m_service->RemoveWatcher(this);
+}
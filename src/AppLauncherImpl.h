@@ -6,21 +6,34 @@
 #ifndef APPLAUNCHER_IMPL_H
 #define APPLAUNCHER_IMPL_H
 
+#include <atomic>
 #include <mutex>
-#include <list>
-#include <condition_variable>
+#include <memory>
+#include <deque>
+#include <functional>
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
 
 #include <grpcpp/ext/proto_server_reflection_plugin.h>
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/health_check_service_interface.h>
+#include <grpcpp/support/message_allocator.h>
+#include <google/protobuf/arena.h>
 
 #include "applauncher.grpc.pb.h"
 #include "systemd_manager.h"
+#include "app_state.h"
+#include "launch_trace.h"
+#include "metrics.h"
+#include "RcuPointer.h"
 
 using grpc::Server;
 using grpc::ServerBuilder;
-using grpc::ServerContext;
-using grpc::ServerWriter;
+using grpc::CallbackServerContext;
+using grpc::ServerUnaryReactor;
+using grpc::ServerWriteReactor;
 using grpc::Status;
 
 using automotivegradelinux::AppLauncher;
@@ -31,58 +44,414 @@ using automotivegradelinux::ListResponse;
 using automotivegradelinux::AppInfo;
 using automotivegradelinux::StatusRequest;
 using automotivegradelinux::StatusResponse;
+using automotivegradelinux::WatchRequest;
+using automotivegradelinux::CatalogUpdate;
+using automotivegradelinux::MetricsRequest;
+using automotivegradelinux::MetricsResponse;
+using automotivegradelinux::LaunchTraceRequest;
+using automotivegradelinux::LaunchTraceResponse;
 
-class AppLauncherImpl final : public AppLauncher::Service
+// Status events and catalog updates are serialized once and the resulting
+// bytes written to every subscriber, and the applications list is served
+// from a cached serialized response, hence the raw methods.
+typedef AppLauncher::WithCallbackMethod_StartApplication<
+	AppLauncher::WithRawCallbackMethod_ListApplications<
+	AppLauncher::WithRawCallbackMethod_GetStatusEvents<
+	AppLauncher::WithRawCallbackMethod_WatchApplications<
+	AppLauncher::WithCallbackMethod_GetMetrics<
+	AppLauncher::WithCallbackMethod_GetLaunchTrace<
+	AppLauncher::Service> > > > > > AppLauncherService;
+
+class AppLauncherImpl;
+
+// Protobuf arena whose first block is part of the object, so that messages
+// (and their strings) up to about Size bytes need no heap allocation at all
+template <size_t Size>
+class InlineArena
+{
+public:
+	InlineArena() : m_arena(Options(m_block)) {}
+
+	google::protobuf::Arena *get() { return &m_arena; }
+
+	template <class Message>
+	Message *Create() {
+		return google::protobuf::Arena::CreateMessage<Message>(&m_arena);
+	}
+
+private:
+	static google::protobuf::ArenaOptions Options(char *block) {
+		google::protobuf::ArenaOptions options;
+		options.initial_block = block;
+		options.initial_block_size = Size;
+		return options;
+	}
+
+	alignas(8) char m_block[Size];
+	google::protobuf::Arena m_arena;
+};
+
+// Callback API message allocator placing the request and response of each
+// call on a per-call arena, released along with the call
+template <class Request, class Response>
+class ArenaMessageAllocator : public grpc::MessageAllocator<Request, Response>
+{
+public:
+	grpc::MessageHolder<Request, Response> *AllocateMessages() override {
+		return new Holder();
+	}
+
+private:
+	class Holder : public grpc::MessageHolder<Request, Response> {
+	public:
+		Holder() {
+			this->set_request(m_arena.template Create<Request>());
+			this->set_response(m_arena.template Create<Response>());
+		}
+
+		void Release() override { delete this; }
+
+	private:
+		InlineArena<512> m_arena;
+	};
+};
+
+// What to do when a subscriber's event queue is full
+enum class OverflowPolicy {
+	DropOldest,
+	Disconnect,
+};
+
+// GetStatusEvents subscription filter, empty sets match everything
+struct StatusFilter {
+	std::set<std::string> app_ids;
+	uint32_t states = 0; // Bitmask of AppState values
+
+	bool MatchesState(automotivegradelinux::AppState state) const {
+		return !states || (states & (1u << state));
+	}
+	bool Matches(const std::string &id, automotivegradelinux::AppState state) const {
+		return (app_ids.empty() || app_ids.count(id)) && MatchesState(state);
+	}
+};
+
+struct SubscriberStats {
+	std::string peer;
+	size_t queue_depth;
+	uint64_t dropped;
+};
+
+// Server stream of pre-serialized events with a bounded write queue, only
+// holds a gRPC thread while one of the reactions below runs.
+class EventStreamReactor : public ServerWriteReactor<grpc::ByteBuffer>
 {
 public:
-	explicit AppLauncherImpl(SystemdManager *manager);
+	EventStreamReactor(const char *method,
+			   const std::string &peer,
+			   size_t queue_size,
+			   OverflowPolicy overflow);
+
+	// Queue an event for writing, may be called from any thread
+	void Send(const grpc::ByteBuffer &event);
+
+	// Finish the stream once any in-flight write has completed
+	void Close(Status status);
+
+	SubscriberStats GetStats();
+
+	const std::string &GetPeer() const { return m_peer; }
+
+	void OnWriteDone(bool ok) override;
+	void OnCancel() override;
+	void OnDone() override;
 
-	Status StartApplication(ServerContext* context,
-				const StartRequest* request,
-				StartResponse* response) override;
+	// Reference held on behalf of gRPC, dropped in OnDone
+	std::shared_ptr<EventStreamReactor> m_self;
 
+protected:
+	// Unregister the stream from the service, called from OnDone
+	virtual void Detach() = 0;
 
-	Status ListApplications(ServerContext* context,
-				const ListRequest* request,
-				ListResponse* response) override;
+	// Must be called with m_mutex held, bounded events are subject to
+	// the overflow policy
+	void QueueLocked(const grpc::ByteBuffer &event, bool bounded);
 
-	Status GetStatusEvents(ServerContext* context,
-			       const StatusRequest* request,
-			       ServerWriter<StatusResponse>* writer) override;
+	// Must be called with m_mutex held
+	bool QueueFullLocked() const { return m_queue.size() >= m_queue_size; }
 
-	void SendStatus(std::string id, std::string status);
+	// Called with m_mutex held once the queue is empty, may provide the
+	// next event to write
+	virtual bool Refill(grpc::ByteBuffer *event) { return false; }
+
+	std::mutex m_mutex;
+
+private:
+	void CloseLocked(Status status);
+	void NextWrite();
+
+	const char *m_method;
+	const std::string m_peer;
+	size_t m_queue_size;
+	OverflowPolicy m_overflow;
+
+	// Pending events, the front one is being written if m_writing is set
+	std::deque<grpc::ByteBuffer> m_queue;
+	uint64_t m_dropped = 0;
+	bool m_writing = false;
+	bool m_closing = false;
+	bool m_finished = false;
+	Status m_status;
+};
+
+// Per-subscriber GetStatusEvents stream
+class StatusEventsReactor : public EventStreamReactor
+{
+public:
+	StatusEventsReactor(AppLauncherImpl *service,
+			    const std::string &peer,
+			    const StatusFilter &filter,
+			    bool conflate);
+
+	// Queue a serialized StatusResponse about the given status, events
+	// already queued (as per their sequence number) are ignored
+	void Send(uint64_t seq,
+		  const grpc::ByteBuffer &event,
+		  const automotivegradelinux::AppStatus &status);
+
+private:
+	friend class AppLauncherImpl;
 
-	void Shutdown() { m_done = true; m_done_cv.notify_all(); }
+	void Detach() override;
+	bool Refill(grpc::ByteBuffer *event) override;
 
-	static void started_cb(AppLauncherImpl *self,
-			       const gchar *app_id,
-			       gpointer caller) {
+	// Queue replayed events regardless of the queue limit
+	void Replay(const grpc::ByteBuffer &event);
+
+	// Set the sequence number of the last event queued so far
+	void SetPosition(uint64_t seq);
+
+	AppLauncherImpl *m_service;
+	const StatusFilter m_filter;
+
+	// Sequence number of the last queued event
+	uint64_t m_last_seq = 0;
+
+	// In conflation mode, events arriving while the queue is full are
+	// collapsed to the latest status of each application, which is sent
+	// as a single batch once the queue has drained
+	const bool m_conflate;
+	std::map<std::string, automotivegradelinux::AppStatus> m_pending;
+	uint64_t m_pending_seq = 0;
+};
+
+// Per-client WatchApplications stream, a client falling behind is
+// disconnected since skipping a diff would corrupt its copy of the catalog
+class CatalogWatchReactor : public EventStreamReactor
+{
+public:
+	CatalogWatchReactor(AppLauncherImpl *service, const std::string &peer);
+
+private:
+	void Detach() override;
+
+	AppLauncherImpl *m_service;
+};
+
+class AppLauncherImpl final : public AppLauncherService
+{
+public:
+	AppLauncherImpl(SystemdManager *manager,
+			size_t queue_size = DEFAULT_QUEUE_SIZE,
+			OverflowPolicy overflow = OverflowPolicy::DropOldest,
+			size_t replay_size = DEFAULT_REPLAY_SIZE);
+	~AppLauncherImpl();
+
+	// Default maximum number of events queued per subscriber
+	static constexpr size_t DEFAULT_QUEUE_SIZE = 64;
+
+	// Default number of past events kept for resuming subscribers
+	static constexpr size_t DEFAULT_REPLAY_SIZE = 256;
+
+	ServerUnaryReactor* StartApplication(CallbackServerContext* context,
+					     const StartRequest* request,
+					     StartResponse* response) override;
+
+	ServerUnaryReactor* ListApplications(CallbackServerContext* context,
+					     const grpc::ByteBuffer* request,
+					     grpc::ByteBuffer* response) override;
+
+	ServerWriteReactor<grpc::ByteBuffer>* GetStatusEvents(CallbackServerContext* context,
+							      const grpc::ByteBuffer* request) override;
+
+	ServerWriteReactor<grpc::ByteBuffer>* WatchApplications(CallbackServerContext* context,
+								const grpc::ByteBuffer* request) override;
+
+	ServerUnaryReactor* GetMetrics(CallbackServerContext* context,
+				       const MetricsRequest* request,
+				       MetricsResponse* response) override;
+
+	ServerUnaryReactor* GetLaunchTrace(CallbackServerContext* context,
+					   const LaunchTraceRequest* request,
+					   LaunchTraceResponse* response) override;
+
+	void SendStatus(const std::string &id,
+			automotivegradelinux::AppState state,
+			automotivegradelinux::FailureReason reason,
+			AppNotify notify = APP_NOTIFY_NONE);
+
+	// Close the streaming calls and reject the commands posted from now
+	// on, the ones already queued are run by the GLib main loop
+	void Shutdown();
+
+	// Event sequence number and history, handed over to the next instance
+	// across restarts so that subscribers can resume without a gap. The
+	// state must be restored before the server starts.
+	GVariant *SaveState();
+	bool RestoreState(GVariant *state);
+
+	std::vector<SubscriberStats> GetSubscriberStats();
+
+	// Export the subscriber queue depths and drops, keyed by peer
+	static void collect_subscriber_metrics_cb(GPtrArray *metrics,
+						  gpointer user_data);
+
+	static void status_changed_cb(AppLauncherImpl *self,
+				      const gchar *app_id,
+				      gint status,
+				      gint reason,
+				      gint notify,
+				      gpointer caller) {
 		if (self)
-			self->HandleAppStarted(app_id);
+			self->HandleAppStatusChanged(app_id,
+						     static_cast<AppStatus>(status),
+						     static_cast<AppFailureReason>(reason),
+						     static_cast<AppNotify>(notify));
 	}
 
-	static void terminated_cb(AppLauncherImpl *self,
-				  const gchar *app_id,
-				  gpointer caller) {
+	static void catalog_changed_cb(AppLauncherImpl *self,
+				       gpointer caller) {
 		if (self)
-			self->HandleAppTerminated(app_id);
+			self->UpdateCatalog();
 	}
 
 private:
-	// systemd event callback handlers
-	void HandleAppStarted(std::string id);
-	void HandleAppTerminated(std::string id);
+	friend class StatusEventsReactor;
+	friend class CatalogWatchReactor;
+
+	// Run a command in the GLib main loop, which owns m_manager and is
+	// the only place it may be used once the server is running. The
+	// command is queued, never run by the calling thread. Once shutting
+	// down, the command is dropped and false returned instead.
+	bool Post(std::function<void()> command);
+
+	// systemd event callback handler
+	void HandleAppStatusChanged(const std::string &id,
+				    AppStatus status,
+				    AppFailureReason reason,
+				    AppNotify notify);
+
+	// Publish a new catalog snapshot and send the differences to the
+	// catalog watchers, called from the GLib main loop when the catalog
+	// changes
+	void UpdateCatalog();
+
+	// Catalog watcher bookkeeping
+	void AddWatcher(std::shared_ptr<CatalogWatchReactor> watcher);
+	void RemoveWatcher(CatalogWatchReactor *watcher);
+
+	// Subscriber bookkeeping, called by the reactors
+	void AddClient(std::shared_ptr<StatusEventsReactor> client,
+		       uint64_t resume_after_seq);
+	void RemoveClient(StatusEventsReactor *client);
+
+	// Must be called with m_history_mutex held
+	grpc::ByteBuffer BuildSnapshot(const StatusFilter &filter);
 
 	// Pointer to systemd wrapping glib object
 	SystemdManager *m_manager;
 
+	ArenaMessageAllocator<StartRequest, StartResponse> m_start_allocator;
+
+	struct {
+		Metric *subscribers;
+		Metric *watchers;
+		Metric *events;
+		Metric *fanout;
+	} m_metrics;
+
+	// Immutable catalog snapshot: the full ListResponse, its serialized
+	// form and an index by application id. A new one is published on
+	// catalog changes, so that any thread can use the current snapshot
+	// without locking.
+	struct Catalog {
+		ListResponse list;
+		grpc::ByteBuffer buffer;
+		std::unordered_map<std::string, int> index;
+
+		const automotivegradelinux::AppInfo *Find(const std::string &id) const;
+	};
+	std::shared_ptr<const Catalog> m_catalog;
+
+	std::shared_ptr<const Catalog> GetCatalog() const {
+		return std::atomic_load(&m_catalog);
+	}
+
+	// Latest status of each application, published the same way. New
+	// tables are published under m_history_mutex, so they match m_seq.
+	typedef std::map<std::string, automotivegradelinux::AppStatus> StatusTable;
+	std::shared_ptr<const StatusTable> m_status_table;
+
+	std::shared_ptr<const StatusTable> GetStatusTable() const {
+		return std::atomic_load(&m_status_table);
+	}
+
+	// WatchApplications streams, the catalog is replaced under
+	// m_watch_mutex so new watchers get a snapshot matching the diffs
+	// that follow it
+	std::mutex m_watch_mutex;
+	std::vector<std::shared_ptr<CatalogWatchReactor> > m_watchers;
+
+	// Per-subscriber queue limit and what to do when it is reached
+	size_t m_queue_size;
+	OverflowPolicy m_overflow;
+
+	// Copy-on-write subscriber index: event dispatch reads the current
+	// snapshot without locking, subscribe/unsubscribe (serialized by
+	// m_clients_mutex) publish a new one, waiting for the dispatch still
+	// using the previous one to complete.
+	// Subscribers are indexed by the applications they are interested
+	// in so that dispatching only visits the relevant ones.
+	typedef std::vector<std::shared_ptr<StatusEventsReactor> > ClientList;
+	struct ClientIndex {
+		ClientList all;
+		ClientList any_app;
+		std::unordered_map<std::string, ClientList> by_app;
+
+		void Add(const std::shared_ptr<StatusEventsReactor> &client);
+	};
 	std::mutex m_clients_mutex;
-	std::list<std::pair<ServerContext*, ServerWriter<StatusResponse>*> > m_clients;
+	RcuPointer<ClientIndex> m_clients;
+	std::atomic<bool> m_done { false };
 
-	std::mutex m_done_mutex;
-	std::condition_variable m_done_cv;
-	bool m_done = false;
+	// Serializes queueing commands with shutting down, so that no
+	// command gets queued after the main loop was drained
+	std::mutex m_post_mutex;
 
+	// Event history for resuming subscribers: the last m_replay_size
+	// events, along with the status table.
+	// Subscribers join under m_history_mutex after replaying, so they
+	// either get an event from the history or from the live dispatch,
+	// duplicates being filtered out by sequence number.
+	std::mutex m_history_mutex;
+	uint64_t m_seq = 0;
+	size_t m_replay_size;
+	struct HistoryEntry {
+		uint64_t seq;
+		std::string id;
+		automotivegradelinux::AppState state;
+		grpc::ByteBuffer event;
+	};
+	std::deque<HistoryEntry> m_history;
 };
 
 #endif // APPLAUNCHER_IMPL_H
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include <google/protobuf/descriptor.h>
+
+#include "MetricsInterceptor.h"
+
+using grpc::experimental::InterceptionHookPoints;
+
+MethodMetrics::MethodMetrics(const std::string &method)
+{
+	std::string labels = "method=\"" + method + "\"";
+
+	requests = metrics_counter("applaunchd_rpc_requests", labels.c_str(),
+				   "RPCs received");
+	errors = metrics_counter("applaunchd_rpc_errors", labels.c_str(),
+				 "RPCs finished with a non-OK status");
+	messages = metrics_counter("applaunchd_rpc_messages_sent", labels.c_str(),
+				   "Messages sent to RPC clients");
+	duration = metrics_histogram("applaunchd_rpc_duration_microseconds", labels.c_str(),
+				     "Time from receiving an RPC to sending its status");
+}
+
+MetricsInterceptor::MetricsInterceptor(const MethodMetrics *metrics) :
+	m_metrics(metrics),
+	m_start(g_get_monotonic_time())
+{
+	metric_inc(m_metrics->requests);
+}
+
+void MetricsInterceptor::Intercept(grpc::experimental::InterceptorBatchMethods *methods)
+{
+	if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_MESSAGE))
+		metric_inc(m_metrics->messages);
+
+	if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_STATUS)) {
+		if (!methods->GetSendStatus().ok())
+			metric_inc(m_metrics->errors);
+		metric_record(m_metrics->duration, g_get_monotonic_time() - m_start);
+	}
+
+	methods->Proceed();
+}
+
+MetricsInterceptorFactory::MetricsInterceptorFactory(const std::vector<std::string> &services) :
+	m_other("other")
+{
+	auto pool = google::protobuf::DescriptorPool::generated_pool();
+
+	for (auto &name : services) {
+		auto service = pool->FindServiceByName(name);
+		if (!service)
+			continue;
+
+		for (int i = 0; i < service->method_count(); i++) {
+			auto method = service->method(i);
+			m_methods.emplace("/" + name + "/" + method->name(),
+					  MethodMetrics(method->name()));
+		}
+	}
+}
+
+grpc::experimental::Interceptor *
+MetricsInterceptorFactory::CreateServerInterceptor(grpc::experimental::ServerRpcInfo *info)
+{
+	auto it = m_methods.find(info->method());
+
+	return new MetricsInterceptor(it != m_methods.end() ? &it->second : &m_other);
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef METRICS_INTERCEPTOR_H
+#define METRICS_INTERCEPTOR_H
+
+#include <string>
+#include <unordered_map>
+
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/support/server_interceptor.h>
+
+#include "metrics.h"
+
+// Metrics kept for each RPC method
+struct MethodMetrics {
+	Metric *requests;
+	Metric *errors;
+	Metric *messages;
+	Metric *duration;
+
+	explicit MethodMetrics(const std::string &method);
+};
+
+// Records the calls, failures, sent messages and duration of every RPC
+class MetricsInterceptor : public grpc::experimental::Interceptor
+{
+public:
+	explicit MetricsInterceptor(const MethodMetrics *metrics);
+
+	void Intercept(grpc::experimental::InterceptorBatchMethods *methods) override;
+
+private:
+	const MethodMetrics *m_metrics;
+	gint64 m_start;
+};
+
+class MetricsInterceptorFactory : public grpc::experimental::ServerInterceptorFactoryInterface
+{
+public:
+	// Metrics are set up for the methods of the given services upfront,
+	// calls to other methods are accounted together
+	explicit MetricsInterceptorFactory(const std::vector<std::string> &services);
+
+	grpc::experimental::Interceptor *CreateServerInterceptor(grpc::experimental::ServerRpcInfo *info) override;
+
+private:
+	// Read-only once constructed, so lookups need no locking
+	std::unordered_map<std::string, MethodMetrics> m_methods;
+	MethodMetrics m_other;
+};
+
+#endif // METRICS_INTERCEPTOR_H
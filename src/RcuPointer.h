@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef RCU_POINTER_H
+#define RCU_POINTER_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// Pointer to an immutable object, read-copy-update style: readers get the
+// current object without taking any lock nor touching a reference count,
+// writers publish a replacement and wait for the readers which may still
+// use the previous one before deleting it.
+//
+// std::atomic_load/std::atomic_store on a shared_ptr are not lock-free in
+// libstdc++: each of them takes one of a small pool of mutexes shared by
+// the whole process. Here, entering a read section is two atomic
+// increments on a counter shared by the readers, and never waits for a
+// writer. The cost moves to the writers, which wait for the readers
+// currently in a read section to leave it, so read sections must stay
+// short and never publish to the same pointer.
+template <class T>
+class RcuPointer
+{
+public:
+	explicit RcuPointer(std::unique_ptr<const T> value) :
+		m_value(value.release()) {}
+
+	~RcuPointer() { delete m_value.load(); }
+
+	RcuPointer(const RcuPointer &) = delete;
+	RcuPointer &operator=(const RcuPointer &) = delete;
+
+	// Read section, the object stays valid as long as the guard lives
+	class ReadGuard
+	{
+	public:
+		explicit ReadGuard(const RcuPointer *pointer) : m_pointer(pointer) {
+			// Register with the current epoch, retrying if a writer
+			// moved to the next one meanwhile: it could have missed us
+			for (;;) {
+				unsigned int epoch = m_pointer->m_epoch.load();
+
+				m_slot = epoch & 1;
+				m_pointer->m_readers[m_slot].fetch_add(1);
+				if (m_pointer->m_epoch.load() == epoch)
+					break;
+				m_pointer->m_readers[m_slot].fetch_sub(1);
+			}
+			m_value = m_pointer->m_value.load();
+		}
+
+		~ReadGuard() { m_pointer->m_readers[m_slot].fetch_sub(1); }
+
+		ReadGuard(const ReadGuard &) = delete;
+		ReadGuard &operator=(const ReadGuard &) = delete;
+
+		const T &operator*() const { return *m_value; }
+		const T *operator->() const { return m_value; }
+
+	private:
+		const RcuPointer *m_pointer;
+		const T *m_value;
+		unsigned int m_slot;
+	};
+
+	ReadGuard Read() const { return ReadGuard(this); }
+
+	// Current object for writers, which no other writer may replace
+	const T &Current() const { return *m_value.load(); }
+
+	// Replace the object, writers must be serialized by the caller and
+	// not be in a read section
+	void Publish(std::unique_ptr<const T> value) {
+		const T *old_value = m_value.exchange(value.release());
+
+		// Readers registered with the epoch before this one may still
+		// use the old object, later ones get the new one
+		unsigned int epoch = m_epoch.fetch_add(1);
+		while (m_readers[epoch & 1].load() != 0)
+			std::this_thread::yield();
+
+		delete old_value;
+	}
+
+private:
+	std::atomic<const T *> m_value;
+	mutable std::atomic<unsigned int> m_epoch { 0 };
+	mutable std::atomic<size_t> m_readers[2] { { 0 }, { 0 } };
+};
+
+#endif
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <grp.h>
+#include <pwd.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include <glib-unix.h>
+#include <grpcpp/server_posix.h>
+#include <systemd/sd-daemon.h>
+
+#include "UnixListener.h"
+
+static bool parse_id(const char *str, unsigned long *id)
+{
+	char *end;
+
+	errno = 0;
+	*id = strtoul(str, &end, 10);
+
+	return *str && !*end && !errno;
+}
+
+bool PeerPolicy::AddUser(const char *user)
+{
+	unsigned long id;
+
+	if (parse_id(user, &id)) {
+		uids.insert(id);
+		return true;
+	}
+
+	struct passwd *pw = getpwnam(user);
+	if (!pw)
+		return false;
+
+	uids.insert(pw->pw_uid);
+	return true;
+}
+
+bool PeerPolicy::AddGroup(const char *group)
+{
+	unsigned long id;
+
+	if (parse_id(group, &id)) {
+		gids.insert(id);
+		return true;
+	}
+
+	struct group *gr = getgrnam(group);
+	if (!gr)
+		return false;
+
+	gids.insert(gr->gr_gid);
+	return true;
+}
+
+bool PeerPolicy::Allows(const struct ucred &cred) const
+{
+	return cred.uid == 0 || cred.uid == getuid() ||
+		uids.count(cred.uid) || gids.count(cred.gid);
+}
+
+UnixListener::UnixListener(const std::string &path, const PeerPolicy &policy) :
+	m_path(path),
+	m_policy(policy)
+{
+}
+
+UnixListener::~UnixListener()
+{
+	if (m_source_id)
+		g_source_remove(m_source_id);
+
+	if (m_fd >= 0) {
+		close(m_fd);
+		if (!m_keep_path)
+			unlink(m_path.c_str());
+	}
+}
+
+bool UnixListener::Listen()
+{
+	struct sockaddr_un addr = {};
+	struct stat st;
+
+	if (m_path.size() >= sizeof(addr.sun_path)) {
+		std::cerr << "Socket path '" << m_path << "' is too long" << std::endl;
+		return false;
+	}
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, m_path.c_str());
+
+	m_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (m_fd < 0) {
+		std::cerr << "Failed to create socket: " << strerror(errno) << std::endl;
+		return false;
+	}
+
+	// Remove the socket of a previous instance, but nothing else
+	if (lstat(m_path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode))
+		unlink(m_path.c_str());
+
+	if (bind(m_fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+		std::cerr << "Failed to bind to '" << m_path << "': "
+			  << strerror(errno) << std::endl;
+		goto error;
+	}
+
+	// Access is checked against the peer credentials on connection
+	chmod(m_path.c_str(), 0666);
+
+	if (listen(m_fd, SOMAXCONN) < 0) {
+		std::cerr << "Failed to listen on '" << m_path << "': "
+			  << strerror(errno) << std::endl;
+		unlink(m_path.c_str());
+		goto error;
+	}
+
+	return true;
+
+error:
+	close(m_fd);
+	m_fd = -1;
+	return false;
+}
+
+bool UnixListener::Adopt(int fd)
+{
+	struct sockaddr_storage addr = {};
+	socklen_t len = sizeof(addr);
+
+	if (getsockname(fd, (struct sockaddr *) &addr, &len) < 0) {
+		std::cerr << "Failed to query socket '" << m_path << "': "
+			  << strerror(errno) << std::endl;
+		return false;
+	}
+
+	// We accept connections until there are none left
+	int flags = fcntl(fd, F_GETFL);
+	if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+		std::cerr << "Failed to make socket '" << m_path << "' non-blocking: "
+			  << strerror(errno) << std::endl;
+		return false;
+	}
+
+	m_fd = fd;
+	m_keep_path = true;
+	m_check_peer = addr.ss_family == AF_UNIX;
+
+	return true;
+}
+
+bool UnixListener::Store()
+{
+	std::string state = std::string("FDSTORE=1\nFDNAME=") + FDNAME;
+
+	// Nothing to do when not running under systemd
+	if (sd_pid_notify_with_fds(0, 0, state.c_str(), &m_fd, 1) <= 0)
+		return false;
+
+	m_keep_path = true;
+
+	return true;
+}
+
+void UnixListener::Attach(grpc::Server *server)
+{
+	m_server = server;
+	m_source_id = g_unix_fd_add(m_fd, G_IO_IN, accept_cb, this);
+}
+
+gboolean UnixListener::accept_cb(gint fd, GIOCondition condition, gpointer user_data)
+{
+	UnixListener *self = static_cast<UnixListener *>(user_data);
+
+	if (self->Accept())
+		return G_SOURCE_CONTINUE;
+
+	// The pending connections would wake us up again right away, stop
+	// watching the socket until some resources were hopefully released
+	self->m_source_id = g_timeout_add(ACCEPT_RETRY_MS, resume_cb, self);
+
+	return G_SOURCE_REMOVE;
+}
+
+gboolean UnixListener::resume_cb(gpointer user_data)
+{
+	UnixListener *self = static_cast<UnixListener *>(user_data);
+
+	self->m_source_id = g_unix_fd_add(self->m_fd, G_IO_IN, accept_cb, self);
+
+	return G_SOURCE_REMOVE;
+}
+
+bool UnixListener::Accept()
+{
+	for (;;) {
+		int fd = accept4(m_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (fd < 0) {
+			int err = errno;
+
+			if (err == EINTR)
+				continue;
+			if (err == EAGAIN || err == EWOULDBLOCK)
+				return true;
+
+			g_warning("Failed to accept connection on '%s': %s",
+				  m_path.c_str(), strerror(err));
+
+			// Connections stay pending in the backlog meanwhile
+			return err != EMFILE && err != ENFILE &&
+				err != ENOBUFS && err != ENOMEM;
+		}
+
+		if (!m_check_peer) {
+			grpc::AddInsecureChannelFromFd(m_server, fd);
+			continue;
+		}
+
+		struct ucred cred;
+		socklen_t len = sizeof(cred);
+		if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) < 0) {
+			g_warning("Failed to get peer credentials: %s", strerror(errno));
+			close(fd);
+			continue;
+		}
+
+		if (!m_policy.Allows(cred)) {
+			g_message("Rejecting connection from pid %d (uid %u, gid %u)",
+				  (int) cred.pid, (unsigned) cred.uid, (unsigned) cred.gid);
+			close(fd);
+			continue;
+		}
+
+		g_debug("Accepting connection from pid %d (uid %u)",
+			(int) cred.pid, (unsigned) cred.uid);
+
+		// The server takes ownership of the connection
+		grpc::AddInsecureChannelFromFd(m_server, fd);
+	}
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef UNIX_LISTENER_H
+#define UNIX_LISTENER_H
+
+#include <set>
+#include <string>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include <glib.h>
+#include <grpcpp/grpcpp.h>
+
+// Which local peers may connect, besides root and our own user
+struct PeerPolicy {
+	std::set<uid_t> uids;
+	std::set<gid_t> gids;
+
+	// Parse a user or group name, or a numeric id
+	bool AddUser(const char *user);
+	bool AddGroup(const char *group);
+
+	bool Allows(const struct ucred &cred) const;
+};
+
+// Unix domain socket listener handing authorized connections to a gRPC
+// server. gRPC does not expose the credentials of Unix socket peers, so
+// connections are accepted from the GLib main loop, checked against the
+// policy using SO_PEERCRED, and only then passed on to the server.
+//
+// It is also used for the sockets passed by systemd socket activation, as
+// gRPC can't take over a listening socket. Those may be TCP sockets, whose
+// connections are passed on unchecked like on the ports gRPC listens on.
+class UnixListener
+{
+public:
+	UnixListener(const std::string &path, const PeerPolicy &policy);
+	~UnixListener();
+
+	// Create the socket, replacing any stale one left behind
+	bool Listen();
+
+	// Take over an already listening socket, e.g. from systemd. The socket
+	// is closed on destruction but its path left in place.
+	bool Adopt(int fd);
+
+	// Put the socket in systemd's file descriptor store, so that the next
+	// instance can take it over. Its path is then left in place too.
+	bool Store();
+
+	// Name of the listening sockets in the file descriptor store
+	static constexpr const char *FDNAME = "listener";
+
+	// Start accepting connections for the given server
+	void Attach(grpc::Server *server);
+
+	const std::string &GetPath() const { return m_path; }
+
+	// How long to stop accepting connections when out of file
+	// descriptors or memory
+	static constexpr guint ACCEPT_RETRY_MS = 100;
+
+private:
+	static gboolean accept_cb(gint fd, GIOCondition condition, gpointer user_data);
+	static gboolean resume_cb(gpointer user_data);
+
+	// Accept the pending connections, false if running out of resources
+	bool Accept();
+
+	std::string m_path;
+	const PeerPolicy &m_policy;
+	grpc::Server *m_server = nullptr;
+	int m_fd = -1;
+	bool m_keep_path = false;
+	bool m_check_peer = true;
+	guint m_source_id = 0;
+};
+
+#endif // UNIX_LISTENER_H
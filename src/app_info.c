@@ -16,12 +16,15 @@ struct _AppInfo {
     gchar *service;
 
     AppStatus status;
+    AppFailureReason failure_reason;
 
     /*
      * `runtime_data` is an opaque pointer depending on the app startup method.
-     * It is set in by ProcessManager or SystemdManager.
+     * It is set in by ProcessManager or SystemdManager, along with the
+     * function destroying it.
      */
     gpointer runtime_data;
+    GDestroyNotify runtime_data_destroy;
 };
 
 G_DEFINE_TYPE(AppInfo, app_info, G_TYPE_OBJECT);
@@ -38,7 +41,7 @@ static void app_info_dispose(GObject *object)
     g_clear_pointer(&self->name, g_free);
     g_clear_pointer(&self->icon_path, g_free);
     g_clear_pointer(&self->service, g_free);
-    g_clear_pointer(&self->runtime_data, g_free);
+    app_info_set_runtime_data(self, NULL, NULL);
 
     G_OBJECT_CLASS(app_info_parent_class)->dispose(object);
 }
@@ -119,11 +122,20 @@ gpointer app_info_get_runtime_data(AppInfo *self)
     return self->runtime_data;
 }
 
-void app_info_set_runtime_data(AppInfo *self, gpointer runtime_data)
+void app_info_set_runtime_data(AppInfo *self, gpointer runtime_data,
+                               GDestroyNotify destroy)
 {
     g_return_if_fail(APPLAUNCHD_IS_APP_INFO(self));
 
+    gpointer old_data = self->runtime_data;
+    GDestroyNotify old_destroy = self->runtime_data_destroy;
+
+    // The old data is destroyed last, it may well be what called us
     self->runtime_data = runtime_data;
+    self->runtime_data_destroy = destroy;
+
+    if (old_data && old_destroy && old_data != runtime_data)
+        old_destroy(old_data);
 }
 
 void app_info_set_status(AppInfo *self, AppStatus status)
@@ -132,3 +144,39 @@ void app_info_set_status(AppInfo *self, AppStatus status)
 
     self->status = status;
 }
+
+AppFailureReason app_info_get_failure_reason(AppInfo *self)
+{
+    g_return_val_if_fail(APPLAUNCHD_IS_APP_INFO(self), APP_FAILURE_NONE);
+
+    return self->failure_reason;
+}
+
+void app_info_set_failure_reason(AppInfo *self, AppFailureReason reason)
+{
+    g_return_if_fail(APPLAUNCHD_IS_APP_INFO(self));
+
+    self->failure_reason = reason;
+}
+
+/*
+ * Update the catalog data of an application, returns whether it changed.
+ */
+gboolean app_info_update(AppInfo *self, const gchar *name,
+                         const gchar *icon_path, const gchar *service)
+{
+    g_return_val_if_fail(APPLAUNCHD_IS_APP_INFO(self), FALSE);
+
+    if (!g_strcmp0(self->name, name) && !g_strcmp0(self->icon_path, icon_path) &&
+        !g_strcmp0(self->service, service))
+        return FALSE;
+
+    g_free(self->name);
+    self->name = g_strdup(name);
+    g_free(self->icon_path);
+    self->icon_path = g_strdup(icon_path);
+    g_free(self->service);
+    self->service = g_strdup(service);
+
+    return TRUE;
+}
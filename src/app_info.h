@@ -11,9 +11,26 @@
 typedef enum {
     APP_STATUS_INACTIVE,
     APP_STATUS_STARTING,
-    APP_STATUS_RUNNING
+    APP_STATUS_RUNNING,
+    APP_STATUS_STOPPING,
+    APP_STATUS_FAILED,
+    APP_STATUS_COUNT
 } AppStatus;
 
+typedef enum {
+    APP_FAILURE_NONE,
+    APP_FAILURE_START_REQUEST,
+    APP_FAILURE_EXIT_CODE,
+    APP_FAILURE_SIGNAL,
+    APP_FAILURE_CORE_DUMP,
+    APP_FAILURE_TIMEOUT,
+    APP_FAILURE_WATCHDOG,
+    APP_FAILURE_START_LIMIT,
+    APP_FAILURE_RESOURCES,
+    APP_FAILURE_OOM_KILL,
+    APP_FAILURE_UNKNOWN
+} AppFailureReason;
+
 G_BEGIN_DECLS
 
 #define APPLAUNCHD_TYPE_APP_INFO app_info_get_type()
@@ -24,6 +41,9 @@ G_DECLARE_FINAL_TYPE(AppInfo, app_info, APPLAUNCHD,
 AppInfo *app_info_new(const gchar *app_id, const gchar *name,
                       const gchar *icon_path, const gchar *service);
 
+gboolean app_info_update(AppInfo *self, const gchar *name,
+                         const gchar *icon_path, const gchar *service);
+
 /* Accessors for read-only members */
 const gchar *app_info_get_app_id(AppInfo *self);
 const gchar *app_info_get_name(AppInfo *self);
@@ -34,8 +54,16 @@ const gchar *app_info_get_service(AppInfo *self);
 AppStatus app_info_get_status(AppInfo *self);
 void app_info_set_status(AppInfo *self, AppStatus status);
 
+AppFailureReason app_info_get_failure_reason(AppInfo *self);
+void app_info_set_failure_reason(AppInfo *self, AppFailureReason reason);
+
+/*
+ * The runtime data is owned by the AppInfo: it is destroyed using `destroy`
+ * when replaced, cleared or when the AppInfo is disposed.
+ */
 gpointer app_info_get_runtime_data(AppInfo *self);
-void app_info_set_runtime_data(AppInfo *self, gpointer runtime_data);
+void app_info_set_runtime_data(AppInfo *self, gpointer runtime_data,
+                               GDestroyNotify destroy);
 
 G_END_DECLS
 
@@ -6,6 +6,7 @@
 
 #include "app_info.h"
 #include "app_launcher.h"
+#include "launch_trace.h"
 #include "systemd_manager.h"
 #include <stdio.h>
 #include <unistd.h> 
@@ -169,6 +170,9 @@ static void app_launcher_started_cb(AppLauncher *self,
      * activated
      */
     applaunchd_app_launch_emit_started(iface, app_id);
+
+    // The D-Bus signal is our only fan-out, which completes the launch
+    launch_trace_mark(app_id, LAUNCH_STAGE_FANNED_OUT, g_get_monotonic_time());
 }
 
 /*
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include <string.h>
+
+#include "app_state.h"
+
+/* Indexed by UnitState, must match the D-Bus ActiveState strings */
+static const gchar *unit_state_names[UNIT_STATE_COUNT] = {
+    [UNIT_STATE_UNKNOWN] = NULL,
+    [UNIT_STATE_ACTIVE] = "active",
+    [UNIT_STATE_RELOADING] = "reloading",
+    [UNIT_STATE_INACTIVE] = "inactive",
+    [UNIT_STATE_FAILED] = "failed",
+    [UNIT_STATE_ACTIVATING] = "activating",
+    [UNIT_STATE_DEACTIVATING] = "deactivating",
+    [UNIT_STATE_MAINTENANCE] = "maintenance",
+    [UNIT_STATE_REFRESHING] = "refreshing",
+};
+
+/* Indexed by AppStatus */
+static const gchar *app_status_names[APP_STATUS_COUNT] = {
+    [APP_STATUS_INACTIVE] = "inactive",
+    [APP_STATUS_STARTING] = "starting",
+    [APP_STATUS_RUNNING] = "running",
+    [APP_STATUS_STOPPING] = "stopping",
+    [APP_STATUS_FAILED] = "failed",
+};
+
+/* Service "Result" property values, see systemd.exec(5) */
+static const struct {
+    const gchar *result;
+    AppFailureReason reason;
+} failure_reasons[] = {
+    { "exit-code", APP_FAILURE_EXIT_CODE },
+    { "signal", APP_FAILURE_SIGNAL },
+    { "core-dump", APP_FAILURE_CORE_DUMP },
+    { "timeout", APP_FAILURE_TIMEOUT },
+    { "watchdog", APP_FAILURE_WATCHDOG },
+    { "start-limit-hit", APP_FAILURE_START_LIMIT },
+    { "resources", APP_FAILURE_RESOURCES },
+    { "oom-kill", APP_FAILURE_OOM_KILL },
+};
+
+/*
+ * Application state machine, indexed by [current status][new unit ActiveState].
+ *
+ * A few notes on the less obvious entries:
+ * - a starting unit back to "inactive" exited before it was seen running,
+ *   see app_state_transition() for the state reported as the start job
+ *   gets queued
+ * - a running unit going back to "activating" is being restarted by
+ *   systemd (Restart=)
+ * - "unknown" (i.e. unparsable) states never change the status
+ */
+static const AppStatus transitions[APP_STATUS_COUNT][UNIT_STATE_COUNT] = {
+    [APP_STATUS_INACTIVE] = {
+        [UNIT_STATE_UNKNOWN]      = APP_STATUS_INACTIVE,
+        [UNIT_STATE_ACTIVE]       = APP_STATUS_RUNNING,
+        [UNIT_STATE_RELOADING]    = APP_STATUS_RUNNING,
+        [UNIT_STATE_INACTIVE]     = APP_STATUS_INACTIVE,
+        [UNIT_STATE_FAILED]       = APP_STATUS_FAILED,
+        [UNIT_STATE_ACTIVATING]   = APP_STATUS_STARTING,
+        [UNIT_STATE_DEACTIVATING] = APP_STATUS_INACTIVE,
+        [UNIT_STATE_MAINTENANCE]  = APP_STATUS_INACTIVE,
+        [UNIT_STATE_REFRESHING]   = APP_STATUS_RUNNING,
+    },
+    [APP_STATUS_STARTING] = {
+        [UNIT_STATE_UNKNOWN]      = APP_STATUS_STARTING,
+        [UNIT_STATE_ACTIVE]       = APP_STATUS_RUNNING,
+        [UNIT_STATE_RELOADING]    = APP_STATUS_RUNNING,
+        [UNIT_STATE_INACTIVE]     = APP_STATUS_INACTIVE,
+        [UNIT_STATE_FAILED]       = APP_STATUS_FAILED,
+        [UNIT_STATE_ACTIVATING]   = APP_STATUS_STARTING,
+        [UNIT_STATE_DEACTIVATING] = APP_STATUS_STOPPING,
+        [UNIT_STATE_MAINTENANCE]  = APP_STATUS_STARTING,
+        [UNIT_STATE_REFRESHING]   = APP_STATUS_RUNNING,
+    },
+    [APP_STATUS_RUNNING] = {
+        [UNIT_STATE_UNKNOWN]      = APP_STATUS_RUNNING,
+        [UNIT_STATE_ACTIVE]       = APP_STATUS_RUNNING,
+        [UNIT_STATE_RELOADING]    = APP_STATUS_RUNNING,
+        [UNIT_STATE_INACTIVE]     = APP_STATUS_INACTIVE,
+        [UNIT_STATE_FAILED]       = APP_STATUS_FAILED,
+        [UNIT_STATE_ACTIVATING]   = APP_STATUS_STARTING,
+        [UNIT_STATE_DEACTIVATING] = APP_STATUS_STOPPING,
+        [UNIT_STATE_MAINTENANCE]  = APP_STATUS_INACTIVE,
+        [UNIT_STATE_REFRESHING]   = APP_STATUS_RUNNING,
+    },
+    [APP_STATUS_STOPPING] = {
+        [UNIT_STATE_UNKNOWN]      = APP_STATUS_STOPPING,
+        [UNIT_STATE_ACTIVE]       = APP_STATUS_RUNNING,
+        [UNIT_STATE_RELOADING]    = APP_STATUS_RUNNING,
+        [UNIT_STATE_INACTIVE]     = APP_STATUS_INACTIVE,
+        [UNIT_STATE_FAILED]       = APP_STATUS_FAILED,
+        [UNIT_STATE_ACTIVATING]   = APP_STATUS_STARTING,
+        [UNIT_STATE_DEACTIVATING] = APP_STATUS_STOPPING,
+        [UNIT_STATE_MAINTENANCE]  = APP_STATUS_INACTIVE,
+        [UNIT_STATE_REFRESHING]   = APP_STATUS_RUNNING,
+    },
+    [APP_STATUS_FAILED] = {
+        [UNIT_STATE_UNKNOWN]      = APP_STATUS_FAILED,
+        [UNIT_STATE_ACTIVE]       = APP_STATUS_RUNNING,
+        [UNIT_STATE_RELOADING]    = APP_STATUS_RUNNING,
+        [UNIT_STATE_INACTIVE]     = APP_STATUS_INACTIVE,
+        [UNIT_STATE_FAILED]       = APP_STATUS_FAILED,
+        [UNIT_STATE_ACTIVATING]   = APP_STATUS_STARTING,
+        [UNIT_STATE_DEACTIVATING] = APP_STATUS_FAILED,
+        [UNIT_STATE_MAINTENANCE]  = APP_STATUS_FAILED,
+        [UNIT_STATE_REFRESHING]   = APP_STATUS_RUNNING,
+    },
+};
+
+/*
+ * Legacy "started"/"terminated" notification for a status change, indexed
+ * by [previous status][new status].
+ *
+ * A restarting application (back to "starting") is reported as terminated
+ * until it is up again, while an aborted stop is not reported at all since
+ * the stop was never announced either.
+ */
+static const AppNotify notifications[APP_STATUS_COUNT][APP_STATUS_COUNT] = {
+    [APP_STATUS_INACTIVE] = {
+        [APP_STATUS_RUNNING] = APP_NOTIFY_STARTED,
+    },
+    [APP_STATUS_STARTING] = {
+        [APP_STATUS_RUNNING] = APP_NOTIFY_STARTED,
+        [APP_STATUS_FAILED] = APP_NOTIFY_TERMINATED,
+    },
+    [APP_STATUS_RUNNING] = {
+        [APP_STATUS_INACTIVE] = APP_NOTIFY_TERMINATED,
+        [APP_STATUS_STARTING] = APP_NOTIFY_TERMINATED,
+        [APP_STATUS_FAILED] = APP_NOTIFY_TERMINATED,
+    },
+    [APP_STATUS_STOPPING] = {
+        [APP_STATUS_INACTIVE] = APP_NOTIFY_TERMINATED,
+        [APP_STATUS_STARTING] = APP_NOTIFY_TERMINATED,
+        [APP_STATUS_FAILED] = APP_NOTIFY_TERMINATED,
+    },
+    [APP_STATUS_FAILED] = {
+        [APP_STATUS_RUNNING] = APP_NOTIFY_STARTED,
+    },
+};
+
+G_STATIC_ASSERT(G_N_ELEMENTS(unit_state_names) == UNIT_STATE_COUNT);
+G_STATIC_ASSERT(G_N_ELEMENTS(app_status_names) == APP_STATUS_COUNT);
+G_STATIC_ASSERT(G_N_ELEMENTS(transitions) == APP_STATUS_COUNT);
+G_STATIC_ASSERT(G_N_ELEMENTS(transitions[0]) == UNIT_STATE_COUNT);
+G_STATIC_ASSERT(G_N_ELEMENTS(notifications) == APP_STATUS_COUNT);
+G_STATIC_ASSERT(G_N_ELEMENTS(notifications[0]) == APP_STATUS_COUNT);
+G_STATIC_ASSERT(APP_NOTIFY_NONE == 0);
+
+/*
+ * Map an ActiveState string to its UnitState value, without copying it.
+ */
+UnitState unit_state_from_string(const gchar *state)
+{
+    if (!state)
+        return UNIT_STATE_UNKNOWN;
+
+    for (gint i = UNIT_STATE_UNKNOWN + 1; i < UNIT_STATE_COUNT; i++) {
+        if (strcmp(state, unit_state_names[i]) == 0)
+            return i;
+    }
+
+    return UNIT_STATE_UNKNOWN;
+}
+
+/*
+ * Map a Service "Result" string to the corresponding failure reason.
+ */
+AppFailureReason app_failure_reason_from_result(const gchar *result)
+{
+    if (!result)
+        return APP_FAILURE_UNKNOWN;
+
+    for (guint i = 0; i < G_N_ELEMENTS(failure_reasons); i++) {
+        if (strcmp(result, failure_reasons[i].result) == 0)
+            return failure_reasons[i].reason;
+    }
+
+    return APP_FAILURE_UNKNOWN;
+}
+
+/*
+ * Map the result of a start job, as sent along with the JobRemoved signal,
+ * to the failure reason of the application: APP_FAILURE_NONE once done,
+ * whether or not the unit actually started, or the start request failing.
+ */
+AppFailureReason app_failure_reason_from_job_result(const gchar *result)
+{
+    if (g_strcmp0(result, "done") == 0)
+        return APP_FAILURE_NONE;
+    if (g_strcmp0(result, "timeout") == 0)
+        return APP_FAILURE_TIMEOUT;
+
+    return APP_FAILURE_START_REQUEST;
+}
+
+/*
+ * Next status of an application given the new ActiveState of its unit.
+ *
+ * `start_pending` tells whether a start job was queued which the unit has
+ * not acted on yet: systemd reports the unit's properties when the job gets
+ * queued, before it moves to "activating", so "inactive" then means the
+ * application is about to start rather than it is done.
+ */
+AppStatus app_state_transition(AppStatus current,
+                               UnitState unit_state,
+                               gboolean start_pending)
+{
+    g_return_val_if_fail(current < APP_STATUS_COUNT, current);
+    g_return_val_if_fail(unit_state < UNIT_STATE_COUNT, current);
+
+    if (start_pending && unit_state == UNIT_STATE_INACTIVE)
+        return APP_STATUS_STARTING;
+
+    return transitions[current][unit_state];
+}
+
+AppNotify app_state_notification(AppStatus previous, AppStatus status)
+{
+    g_return_val_if_fail(previous < APP_STATUS_COUNT, APP_NOTIFY_NONE);
+    g_return_val_if_fail(status < APP_STATUS_COUNT, APP_NOTIFY_NONE);
+
+    return notifications[previous][status];
+}
+
+const gchar *app_status_to_string(AppStatus status)
+{
+    g_return_val_if_fail(status < APP_STATUS_COUNT, NULL);
+
+    return app_status_names[status];
+}
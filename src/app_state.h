@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef APPSTATE_H
+#define APPSTATE_H
+
+#include <glib.h>
+
+#include "app_info.h"
+
+G_BEGIN_DECLS
+
+/*
+ * systemd unit ActiveState values, see org.freedesktop.systemd1(5)
+ */
+typedef enum {
+    UNIT_STATE_UNKNOWN,
+    UNIT_STATE_ACTIVE,
+    UNIT_STATE_RELOADING,
+    UNIT_STATE_INACTIVE,
+    UNIT_STATE_FAILED,
+    UNIT_STATE_ACTIVATING,
+    UNIT_STATE_DEACTIVATING,
+    UNIT_STATE_MAINTENANCE,
+    UNIT_STATE_REFRESHING,
+    UNIT_STATE_COUNT
+} UnitState;
+
+/*
+ * Legacy notification for a status change, used for the
+ * "started"/"terminated" signals.
+ */
+typedef enum {
+    APP_NOTIFY_NONE,
+    APP_NOTIFY_STARTED,
+    APP_NOTIFY_TERMINATED
+} AppNotify;
+
+UnitState unit_state_from_string(const gchar *state);
+
+AppFailureReason app_failure_reason_from_result(const gchar *result);
+
+AppFailureReason app_failure_reason_from_job_result(const gchar *result);
+
+AppStatus app_state_transition(AppStatus current,
+                               UnitState unit_state,
+                               gboolean start_pending);
+
+AppNotify app_state_notification(AppStatus previous, AppStatus status);
+
+const gchar *app_status_to_string(AppStatus status);
+
+G_END_DECLS
+
+#endif
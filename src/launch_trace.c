@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include <unistd.h>
+
+#include "launch_trace.h"
+#include "metrics.h"
+
+/* Number of completed launches kept for the trace dump */
+#define LAUNCH_TRACE_HISTORY 64
+
+typedef struct {
+    gchar *app_id;
+    gint64 stages[LAUNCH_STAGE_COUNT];
+    gboolean failed;
+} LaunchRecord;
+
+static const gchar *launch_stage_names[LAUNCH_STAGE_COUNT] = {
+    [LAUNCH_STAGE_REQUEST_RECEIVED] = "request received",
+    [LAUNCH_STAGE_LOOKUP_DONE] = "lookup done",
+    [LAUNCH_STAGE_START_UNIT_ISSUED] = "StartUnit issued",
+    [LAUNCH_STAGE_JOB_QUEUED] = "job queued",
+    [LAUNCH_STAGE_INACTIVE_EXIT] = "inactive exit",
+    [LAUNCH_STAGE_ACTIVE_ENTER] = "active enter",
+    [LAUNCH_STAGE_RUNNING] = "running",
+    [LAUNCH_STAGE_FANNED_OUT] = "fanned out",
+};
+
+/*
+ * Launch phases, splitting the latency between applaunchd ("request" and
+ * "notify"), systemd ("job") and the application itself ("startup")
+ */
+static const struct {
+    const gchar *name;
+    LaunchStage from;
+    LaunchStage to;
+} launch_phases[] = {
+    { "request", LAUNCH_STAGE_REQUEST_RECEIVED, LAUNCH_STAGE_START_UNIT_ISSUED },
+    { "job", LAUNCH_STAGE_START_UNIT_ISSUED, LAUNCH_STAGE_INACTIVE_EXIT },
+    { "startup", LAUNCH_STAGE_INACTIVE_EXIT, LAUNCH_STAGE_ACTIVE_ENTER },
+    { "notify", LAUNCH_STAGE_ACTIVE_ENTER, LAUNCH_STAGE_FANNED_OUT },
+};
+
+static GMutex trace_lock;
+/* Launches in progress, by application ID */
+static GHashTable *active_launches;
+/* Completed launches, oldest first */
+static GQueue completed_launches = G_QUEUE_INIT;
+
+static void launch_record_free(gpointer data)
+{
+    LaunchRecord *record = data;
+
+    g_free(record->app_id);
+    g_free(record);
+}
+
+/*
+ * Feed the per-application latency histograms with a successful launch.
+ */
+static void launch_record_account(LaunchRecord *record)
+{
+    gint64 *stages = record->stages;
+    g_autofree gchar *labels = g_strdup_printf("app=\"%s\"", record->app_id);
+
+    metric_record(metrics_histogram("applaunchd_launch_duration_microseconds", labels,
+                                    "Time from start request to subscribers notified"),
+                  stages[LAUNCH_STAGE_FANNED_OUT] - stages[LAUNCH_STAGE_REQUEST_RECEIVED]);
+
+    for (guint i = 0; i < G_N_ELEMENTS(launch_phases); i++) {
+        gint64 from = stages[launch_phases[i].from];
+        gint64 to = stages[launch_phases[i].to];
+
+        if (!from || !to || to < from)
+            continue;
+
+        g_autofree gchar *phase_labels =
+            g_strdup_printf("app=\"%s\",phase=\"%s\"", record->app_id, launch_phases[i].name);
+        metric_record(metrics_histogram("applaunchd_launch_phase_duration_microseconds",
+                                        phase_labels, "Duration of the launch phases"),
+                      to - from);
+    }
+}
+
+/*
+ * Must be called with trace_lock held.
+ */
+static void launch_record_complete(LaunchRecord *record, gboolean failed)
+{
+    g_hash_table_steal(active_launches, record->app_id);
+
+    record->failed = failed;
+    if (!failed)
+        launch_record_account(record);
+
+    g_queue_push_tail(&completed_launches, record);
+    if (completed_launches.length > LAUNCH_TRACE_HISTORY)
+        launch_record_free(g_queue_pop_head(&completed_launches));
+}
+
+void launch_trace_begin(const gchar *app_id, gint64 request_time)
+{
+    LaunchRecord *record = g_new0(LaunchRecord, 1);
+
+    record->app_id = g_strdup(app_id);
+    record->stages[LAUNCH_STAGE_REQUEST_RECEIVED] =
+        request_time ? request_time : g_get_monotonic_time();
+
+    g_mutex_lock(&trace_lock);
+    if (!active_launches)
+        active_launches = g_hash_table_new_full(g_str_hash, g_str_equal,
+                                                NULL, launch_record_free);
+    g_hash_table_replace(active_launches, record->app_id, record);
+    g_mutex_unlock(&trace_lock);
+}
+
+void launch_trace_mark(const gchar *app_id, LaunchStage stage, gint64 timestamp)
+{
+    g_return_if_fail(stage < LAUNCH_STAGE_COUNT);
+
+    g_mutex_lock(&trace_lock);
+
+    LaunchRecord *record = active_launches ? g_hash_table_lookup(active_launches, app_id) : NULL;
+    if (record && timestamp) {
+        record->stages[stage] = timestamp;
+        if (stage == LAUNCH_STAGE_FANNED_OUT)
+            launch_record_complete(record, FALSE);
+    }
+
+    g_mutex_unlock(&trace_lock);
+}
+
+void launch_trace_fail(const gchar *app_id)
+{
+    g_mutex_lock(&trace_lock);
+
+    LaunchRecord *record = active_launches ? g_hash_table_lookup(active_launches, app_id) : NULL;
+    if (record)
+        launch_record_complete(record, TRUE);
+
+    g_mutex_unlock(&trace_lock);
+}
+
+static void json_append_string(GString *out, const gchar *str)
+{
+    g_string_append_c(out, '"');
+    for (const gchar *c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            g_string_append_c(out, '\\');
+        g_string_append_c(out, *c);
+    }
+    g_string_append_c(out, '"');
+}
+
+static void json_append_event(GString *out, const gchar *name, const gchar *phase,
+                              gint pid, guint tid, gint64 ts, gint64 dur,
+                              const gchar *app_id)
+{
+    if (out->str[out->len - 1] != '[')
+        g_string_append(out, ",\n");
+
+    g_string_append(out, "{\"name\":");
+    json_append_string(out, name);
+    g_string_append_printf(out, ",\"cat\":\"launch\",\"ph\":\"%s\",\"pid\":%d,\"tid\":%u,"
+                           "\"ts\":%" G_GINT64_FORMAT, phase, pid, tid, ts);
+    if (dur >= 0)
+        g_string_append_printf(out, ",\"dur\":%" G_GINT64_FORMAT, dur);
+    else
+        g_string_append(out, ",\"s\":\"t\"");
+    g_string_append(out, ",\"args\":{\"app\":");
+    json_append_string(out, app_id);
+    g_string_append(out, "}}");
+}
+
+gchar *launch_trace_to_json(void)
+{
+    GString *out = g_string_new("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    g_autoptr(GHashTable) tids = g_hash_table_new(g_str_hash, g_str_equal);
+    gint pid = getpid();
+
+    g_mutex_lock(&trace_lock);
+
+    for (GList *l = completed_launches.head; l != NULL; l = l->next) {
+        LaunchRecord *record = l->data;
+        gint64 *stages = record->stages;
+
+        // One track per application
+        guint tid = GPOINTER_TO_UINT(g_hash_table_lookup(tids, record->app_id));
+        if (!tid) {
+            tid = g_hash_table_size(tids) + 1;
+            g_hash_table_insert(tids, record->app_id, GUINT_TO_POINTER(tid));
+
+            if (out->str[out->len - 1] != '[')
+                g_string_append(out, ",\n");
+            g_string_append_printf(out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                                   "\"tid\":%u,\"args\":{\"name\":", pid, tid);
+            json_append_string(out, record->app_id);
+            g_string_append(out, "}}");
+        }
+
+        // Whole launch, up to the last stage reached
+        gint64 end = 0;
+        for (guint i = 0; i < LAUNCH_STAGE_COUNT; i++)
+            end = MAX(end, stages[i]);
+        json_append_event(out, record->failed ? "launch (failed)" : "launch", "X", pid, tid,
+                          stages[LAUNCH_STAGE_REQUEST_RECEIVED],
+                          end - stages[LAUNCH_STAGE_REQUEST_RECEIVED], record->app_id);
+
+        for (guint i = 0; i < G_N_ELEMENTS(launch_phases); i++) {
+            gint64 from = stages[launch_phases[i].from];
+            gint64 to = stages[launch_phases[i].to];
+
+            if (from && to && to >= from)
+                json_append_event(out, launch_phases[i].name, "X", pid, tid,
+                                  from, to - from, record->app_id);
+        }
+
+        for (guint i = 0; i < LAUNCH_STAGE_COUNT; i++) {
+            if (stages[i])
+                json_append_event(out, launch_stage_names[i], "i", pid, tid,
+                                  stages[i], -1, record->app_id);
+        }
+    }
+
+    g_mutex_unlock(&trace_lock);
+
+    g_string_append(out, "]}\n");
+
+    return g_string_free(out, FALSE);
+}
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef LAUNCHTRACE_H
+#define LAUNCHTRACE_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Stages of an application launch, all timestamps being CLOCK_MONOTONIC
+ * microseconds as returned by g_get_monotonic_time() and used by systemd's
+ * *TimestampMonotonic properties.
+ */
+typedef enum {
+    LAUNCH_STAGE_REQUEST_RECEIVED,
+    LAUNCH_STAGE_LOOKUP_DONE,
+    LAUNCH_STAGE_START_UNIT_ISSUED,
+    LAUNCH_STAGE_JOB_QUEUED,
+    LAUNCH_STAGE_INACTIVE_EXIT,
+    LAUNCH_STAGE_ACTIVE_ENTER,
+    LAUNCH_STAGE_RUNNING,
+    // Subscribers were told, over gRPC or by the D-Bus "started" signal
+    LAUNCH_STAGE_FANNED_OUT,
+    LAUNCH_STAGE_COUNT
+} LaunchStage;
+
+/*
+ * Start tracking a launch of the given application, replacing any launch
+ * of it still in progress.
+ */
+void launch_trace_begin(const gchar *app_id, gint64 request_time);
+
+/*
+ * Record a stage of the launch in progress, if any. Reaching
+ * LAUNCH_STAGE_FANNED_OUT completes the launch.
+ */
+void launch_trace_mark(const gchar *app_id, LaunchStage stage, gint64 timestamp);
+
+/*
+ * Complete the launch in progress, if any, as failed.
+ */
+void launch_trace_fail(const gchar *app_id);
+
+/*
+ * Render the recently completed launches in the Chrome trace event JSON
+ * format, which Perfetto and chrome://tracing can open.
+ */
+gchar *launch_trace_to_json(void);
+
+G_END_DECLS
+
+#endif
@@ -3,18 +3,81 @@
  * Copyright (C) 2022 Konsulko Group
  */
 
+#include <algorithm>
 #include <thread>
 #include <chrono>
+#include <cstring>
+#include <unistd.h>
+#include <sys/un.h>
 #include <glib.h>
 #include <glib-unix.h>
+#include <systemd/sd-daemon.h>
 
 #include "systemd_manager.h"
 #include "AppLauncherImpl.h"
+#include "UnixListener.h"
+#include "MetricsInterceptor.h"
+#include "startup_profile.h"
+#include "state_store.h"
+
+// Default status coalescing window, in ms
+#define DEFAULT_COALESCE_WINDOW 20
+
+// Listening address when none is given on the command line, also the one
+// of data/applaunchd.socket
+#define DEFAULT_LISTEN_ADDRESS "127.0.0.1:50052"
 
 GMainLoop *main_loop = NULL;
 
 AppLauncherImpl *g_service = NULL;
 
+static gint coalesce_window = DEFAULT_COALESCE_WINDOW;
+static gint queue_size = AppLauncherImpl::DEFAULT_QUEUE_SIZE;
+static gchar *overflow = NULL;
+static gint replay_size = AppLauncherImpl::DEFAULT_REPLAY_SIZE;
+static gchar **listen_addresses = NULL;
+static gchar **allowed_users = NULL;
+static gchar **allowed_groups = NULL;
+static gchar *metrics_socket = NULL;
+static gboolean systemd_private = FALSE;
+
+// State handed over across restarts, NULL if the file descriptor store is
+// not available
+static StateStore *state_store = NULL;
+static guint state_save_source = 0;
+
+static GOptionEntry entries[] = {
+    { "coalesce-window", 'c', 0, G_OPTION_ARG_INT, &coalesce_window,
+      "Window during which status changes of an application are coalesced, 0 to disable",
+      "MS" },
+    { "queue-size", 'q', 0, G_OPTION_ARG_INT, &queue_size,
+      "Maximum number of status events queued per subscriber",
+      "N" },
+    { "overflow", 'o', 0, G_OPTION_ARG_STRING, &overflow,
+      "What to do when a subscriber queue is full: drop-oldest (default) or disconnect",
+      "POLICY" },
+    { "replay-size", 'r', 0, G_OPTION_ARG_INT, &replay_size,
+      "Number of past status events kept for resuming subscribers",
+      "N" },
+    { "listen", 'l', 0, G_OPTION_ARG_STRING_ARRAY, &listen_addresses,
+      "Address to listen on, either host:port or unix:PATH, may be repeated "
+      "(default: " DEFAULT_LISTEN_ADDRESS ")",
+      "ADDRESS" },
+    { "allow-user", 'u', 0, G_OPTION_ARG_STRING_ARRAY, &allowed_users,
+      "User allowed to connect to unix: listeners besides root and ourselves, may be repeated",
+      "USER" },
+    { "allow-group", 'g', 0, G_OPTION_ARG_STRING_ARRAY, &allowed_groups,
+      "Primary group allowed to connect to unix: listeners, may be repeated",
+      "GROUP" },
+    { "metrics-socket", 'm', 0, G_OPTION_ARG_FILENAME, &metrics_socket,
+      "Unix socket on which to serve metrics in the OpenMetrics text format over HTTP",
+      "PATH" },
+    { "systemd-private", 'p', 0, G_OPTION_ARG_NONE, &systemd_private,
+      "Talk to systemd over its private socket rather than the system bus, requires root",
+      NULL },
+    { NULL }
+};
+
 static gboolean quit_cb(gpointer user_data)
 {
     g_info("Quitting...");
@@ -27,6 +90,128 @@ static gboolean quit_cb(gpointer user_data)
     return G_SOURCE_REMOVE;
 }
 
+/*
+ * File descriptors passed by systemd: sockets from socket activation, and
+ * the ones we put in the file descriptor store before restarting.
+ */
+struct PassedFds {
+    std::vector<std::pair<int, std::string> > activated;
+    std::vector<int> listeners;
+    int state = -1;
+};
+
+static bool get_passed_fds(PassedFds &fds)
+{
+    char **names = NULL;
+    int n_fds = sd_listen_fds_with_names(1, &names);
+    if (n_fds < 0) {
+        std::cerr << "Failed to get passed file descriptors: " << g_strerror(-n_fds) << std::endl;
+        return false;
+    }
+
+    for (int i = 0; i < n_fds; i++) {
+        int fd = SD_LISTEN_FDS_START + i;
+        std::string name = names && names[i] ? names[i] : std::to_string(fd);
+
+        if (name == STATE_STORE_FDNAME && fds.state < 0)
+            fds.state = fd;
+        else if (name == UnixListener::FDNAME)
+            fds.listeners.push_back(fd);
+        else
+            fds.activated.emplace_back(fd, name);
+    }
+    g_strfreev(names);
+
+    return true;
+}
+
+// Path of a Unix socket, empty if it is not one
+static std::string socket_path(int fd)
+{
+    struct sockaddr_un addr = {};
+    socklen_t len = sizeof(addr);
+
+    if (getsockname(fd, (struct sockaddr *) &addr, &len) < 0 || addr.sun_family != AF_UNIX)
+        return std::string();
+
+    return std::string(addr.sun_path, strnlen(addr.sun_path, sizeof(addr.sun_path)));
+}
+
+/*
+ * Take over the listening sockets passed by systemd socket activation, so
+ * that clients can connect before we're done initializing: the kernel
+ * queues their connections until the server is started.
+ * Returns the number of sockets, or -1 on error.
+ */
+static int adopt_activated_sockets(const PeerPolicy &policy,
+                                   const std::vector<std::pair<int, std::string> > &sockets,
+                                   std::vector<std::unique_ptr<UnixListener> > &listeners)
+{
+    int ret = sockets.size();
+    for (auto &socket : sockets) {
+        int fd = socket.first;
+        const std::string &name = socket.second;
+
+        if (ret < 0 || sd_is_socket(fd, AF_UNSPEC, SOCK_STREAM, 1) <= 0) {
+            if (ret >= 0)
+                std::cerr << "Activated socket '" << name
+                          << "' is not a listening stream socket" << std::endl;
+            close(fd);
+            ret = -1;
+            continue;
+        }
+
+        auto listener = std::make_unique<UnixListener>(name, policy);
+        if (!listener->Adopt(fd)) {
+            close(fd);
+            ret = -1;
+            continue;
+        }
+        listeners.push_back(std::move(listener));
+    }
+
+    return ret;
+}
+
+static gboolean save_state_cb(gpointer user_data)
+{
+    state_save_source = 0;
+
+    GVariant *state = g_variant_new("(vv)",
+                                    systemd_manager_save_state(systemd_manager_get_default()),
+                                    g_service->SaveState());
+    state_store_save(state_store, state);
+
+    return G_SOURCE_REMOVE;
+}
+
+// Save the state once the current change has been dispatched. Saving means
+// serializing and hashing the whole state, so the changes notified within a
+// coalescing window are batched in a single save.
+static void schedule_state_save()
+{
+    if (!state_store || state_save_source)
+        return;
+
+    if (coalesce_window > 0)
+        state_save_source = g_timeout_add_full(G_PRIORITY_LOW, coalesce_window,
+                                               save_state_cb, NULL, NULL);
+    else
+        state_save_source = g_idle_add_full(G_PRIORITY_LOW, save_state_cb, NULL, NULL);
+}
+
+static void state_status_changed_cb(gpointer data, const gchar *app_id,
+                                    gint status, gint reason, gint notify,
+                                    gpointer caller)
+{
+    schedule_state_save();
+}
+
+static void state_catalog_changed_cb(gpointer data, gpointer caller)
+{
+    schedule_state_save();
+}
+
 void RunGrpcServer(std::shared_ptr<Server> &server)
 {
     // Start server and wait for shutdown
@@ -35,21 +220,171 @@ void RunGrpcServer(std::shared_ptr<Server> &server)
 
 int main(int argc, char *argv[])
 {
+    startup_profile_begin();
+
+    GError *error = NULL;
+    GOptionContext *context = g_option_context_new("- AGL application launcher");
+    g_option_context_add_main_entries(context, entries, NULL);
+    if (!g_option_context_parse(context, &argc, &argv, &error)) {
+        std::cerr << "Option parsing failed: " << error->message << std::endl;
+        g_error_free(error);
+        exit(1);
+    }
+    g_option_context_free(context);
+
+    OverflowPolicy overflow_policy = OverflowPolicy::DropOldest;
+    if (overflow && !g_strcmp0(overflow, "disconnect")) {
+        overflow_policy = OverflowPolicy::Disconnect;
+    } else if (overflow && g_strcmp0(overflow, "drop-oldest")) {
+        std::cerr << "Unknown overflow policy '" << overflow << "'" << std::endl;
+        exit(1);
+    }
+
+    PeerPolicy policy;
+    for (gchar **user = allowed_users; user && *user; user++) {
+        if (!policy.AddUser(*user)) {
+            std::cerr << "Unknown user '" << *user << "'" << std::endl;
+            exit(1);
+        }
+    }
+    for (gchar **group = allowed_groups; group && *group; group++) {
+        if (!policy.AddGroup(*group)) {
+            std::cerr << "Unknown group '" << *group << "'" << std::endl;
+            exit(1);
+        }
+    }
+
+    PassedFds passed_fds;
+    if (!get_passed_fds(passed_fds))
+        exit(1);
+
+    // systemd sets $FDSTORE when we may use the file descriptor store
+    const char *fdstore = getenv("FDSTORE");
+    bool use_fd_store = fdstore && atoi(fdstore) > 0;
+
+    // Pick up the state of the previous instance, if any
+    GVariant *manager_state = NULL;
+    GVariant *service_state = NULL;
+    if (use_fd_store) {
+        gint64 start = g_get_monotonic_time();
+        state_store = state_store_new(passed_fds.state);
+        GVariant *state = NULL;
+        if (state_store && passed_fds.state >= 0)
+            state = state_store_load(state_store, G_VARIANT_TYPE("(vv)"));
+        if (state) {
+            g_variant_get(state, "(vv)", &manager_state, &service_state);
+            g_variant_unref(state);
+        }
+        startup_profile_add(STARTUP_PHASE_STATE_RESTORE, start);
+    } else if (passed_fds.state >= 0) {
+        close(passed_fds.state);
+    }
+
     main_loop = g_main_loop_new(NULL, FALSE);
 
-    SystemdManager *manager = systemd_manager_get_default();
+    gboolean restored = FALSE;
+    systemd_manager_set_use_private_socket(systemd_private);
+    SystemdManager *manager = systemd_manager_get_default_with_state(manager_state, &restored);
+    systemd_manager_set_coalesce_window(manager, MAX(coalesce_window, 0));
+
+    GSocketService *metrics_exporter = NULL;
+    if (metrics_socket) {
+        metrics_exporter = metrics_exporter_new(metrics_socket, &error);
+        if (!metrics_exporter) {
+            std::cerr << "Failed to serve metrics on '" << metrics_socket << "': "
+                      << error->message << std::endl;
+            g_error_free(error);
+            exit(1);
+        }
+    }
 
+    gint64 start = g_get_monotonic_time();
     grpc::EnableDefaultHealthCheckService(true);
     grpc::reflection::InitProtoReflectionServerBuilderPlugin();
     ServerBuilder builder;
 
-    // Listen on the given address without any authentication mechanism (for now)
-    std::string server_address("localhost:50052");
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    std::vector<std::unique_ptr<grpc::experimental::ServerInterceptorFactoryInterface> > interceptors;
+    interceptors.push_back(std::make_unique<MetricsInterceptorFactory>(
+        std::vector<std::string> { AppLauncher::service_full_name() }));
+    builder.experimental().SetInterceptorCreators(std::move(interceptors));
+
+    // TCP addresses are handled by gRPC itself, without any authentication
+    // mechanism. Unix sockets are ours, so that we can check the
+    // credentials of the peers before handing connections over.
+    std::vector<std::string> addresses;
+    std::vector<std::unique_ptr<UnixListener> > unix_listeners;
+    int n_activated = adopt_activated_sockets(policy, passed_fds.activated, unix_listeners);
+    if (n_activated < 0)
+        exit(1);
+
+    if (listen_addresses && *listen_addresses) {
+        for (gchar **address = listen_addresses; *address; address++)
+            addresses.push_back(*address);
+    } else if (n_activated == 0) {
+        addresses.push_back(DEFAULT_LISTEN_ADDRESS);
+    }
+
+    // Stored sockets are stored again as they get used, drop the others
+    if (!passed_fds.listeners.empty())
+        sd_notify(0, (std::string("FDSTOREREMOVE=1\nFDNAME=") + UnixListener::FDNAME).c_str());
+
+    for (auto &address : addresses) {
+        if (g_str_has_prefix(address.c_str(), "unix:")) {
+            // Accept both unix:PATH and unix://PATH
+            std::string path = address.substr(5);
+            if (g_str_has_prefix(path.c_str(), "//"))
+                path.erase(0, 2);
+
+            // Take over the socket of the previous instance, if any, so
+            // that no connection gets refused while restarting
+            auto listener = std::make_unique<UnixListener>(path, policy);
+            auto stored = std::find_if(passed_fds.listeners.begin(), passed_fds.listeners.end(),
+                                       [&](int fd) { return socket_path(fd) == path; });
+            if (stored != passed_fds.listeners.end()) {
+                if (!listener->Adopt(*stored))
+                    exit(1);
+                passed_fds.listeners.erase(stored);
+            } else if (!listener->Listen()) {
+                exit(1);
+            }
+            if (use_fd_store)
+                listener->Store();
+            unix_listeners.push_back(std::move(listener));
+        } else {
+            builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+        }
+    }
+
+    for (int fd : passed_fds.listeners)
+        close(fd);
 
     // Register "service" as the instance through which we'll communicate with
-    // clients. In this case it corresponds to a *synchronous* service.
-    AppLauncherImpl *service = new AppLauncherImpl(manager);
+    // clients. In this case it corresponds to a *callback* service, so
+    // streaming subscribers do not hold on to a server thread.
+    AppLauncherImpl *service = new AppLauncherImpl(manager,
+                                                   MAX(queue_size, 1),
+                                                   overflow_policy,
+                                                   MAX(replay_size, 0));
+    g_service = service;
+
+    if (restored && service_state) {
+        gint64 start = g_get_monotonic_time();
+        service->RestoreState(service_state);
+        startup_profile_add(STARTUP_PHASE_STATE_RESTORE, start);
+    }
+    g_clear_pointer(&manager_state, g_variant_unref);
+    g_clear_pointer(&service_state, g_variant_unref);
+
+    if (state_store) {
+        systemd_manager_connect_status_callback(manager,
+                                                G_CALLBACK(state_status_changed_cb),
+                                                NULL);
+        systemd_manager_connect_catalog_callback(manager,
+                                                 G_CALLBACK(state_catalog_changed_cb),
+                                                 NULL);
+        save_state_cb(NULL);
+    }
+
     builder.RegisterService(service);
 
     // Finally assemble the server.
@@ -57,7 +392,13 @@ int main(int argc, char *argv[])
     if (!server) {
         exit(1);
     }
-    std::cout << "Server listening on " << server_address << std::endl;
+    for (auto &listener : unix_listeners)
+        listener->Attach(server.get());
+    startup_profile_add(STARTUP_PHASE_SERVICE, start);
+    for (auto &address : addresses)
+        std::cout << "Server listening on " << address << std::endl;
+    if (n_activated > 0)
+        std::cout << "Server listening on " << n_activated << " activated socket(s)" << std::endl;
 
     g_unix_signal_add(SIGTERM, quit_cb, (gpointer) &server);
     g_unix_signal_add(SIGINT, quit_cb, (gpointer) &server);
@@ -65,18 +406,51 @@ int main(int argc, char *argv[])
     // Start gRPC API server on its own thread
     std::thread grpc_thread(RunGrpcServer, std::ref(server));
 
+    // Clients can connect and the catalog is loaded: we're ready, start
+    // requests reaching us from now on get handled once the loop runs
+    gint64 startup = startup_profile_finish();
+    gchar *report = startup_profile_report();
+    g_message("%s", report);
+    g_free(report);
+    sd_notifyf(0, "READY=1\nSTATUS=Ready in %" G_GINT64_FORMAT " ms", startup / 1000);
+
     g_main_loop_run(main_loop);
 
-    // Service implementation may have threads blocked from client streaming
-    // RPCs, make sure those exit.
+    sd_notify(0, "STOPPING=1");
+
+    // Finish the client streaming RPCs and reject new commands so the
+    // server can shut down
     service->Shutdown();
 
-    // Need to set a deadline to avoid blocking on clients doing streaming
-    // RPC reads
+    // Run the commands queued until then, they finish their calls
+    while (g_main_context_iteration(g_main_loop_get_context(main_loop), FALSE));
+
+    // Need to set a deadline to avoid blocking on clients not draining
+    // their streams
     server->Shutdown(std::chrono::system_clock::now() + std::chrono::milliseconds(500));
 
     grpc_thread.join();
 
+    // Hand the final state over to the next instance
+    if (state_store) {
+        if (state_save_source)
+            g_source_remove(state_save_source);
+        save_state_cb(NULL);
+        state_store_free(state_store);
+    }
+
+    unix_listeners.clear();
+
+    if (metrics_exporter) {
+        g_socket_service_stop(metrics_exporter);
+        g_socket_listener_close(G_SOCKET_LISTENER(metrics_exporter));
+        g_object_unref(metrics_exporter);
+        unlink(metrics_socket);
+    }
+
+    g_debug("%" G_GUINT64_FORMAT " status events were coalesced",
+            systemd_manager_get_suppressed_events(manager));
+
     g_object_unref(manager);
 
     g_main_loop_unref(main_loop);
@@ -7,17 +7,22 @@
 #include <glib.h>
 #include <glib-unix.h>
 #include <systemd/sd-bus.h>
+#include <systemd/sd-daemon.h>
 #include <systemd/sd-event.h>
 #include <stdio.h>
 #include <unistd.h>
 #include "app_launcher.h"
 #include "applaunch-dbus.h"
+#include "startup_profile.h"
 
 #define APPLAUNCH_DBUS_NAME "org.automotivelinux.AppLaunch"
 #define APPLAUNCH_DBUS_PATH "/org/automotivelinux/AppLaunch"
 
 GMainLoop *main_loop = NULL;
 
+// Time at which we started exporting our D-Bus service
+static gint64 service_start;
+
 static gboolean quit_cb(gpointer user_data)
 {
     g_info("Quitting...");
@@ -44,6 +49,13 @@ static void name_acquired_cb(GDBusConnection *connection, const gchar *name,
                              gpointer user_data)
 {
     g_debug("D-Bus name '%s' was acquired", name);
+
+    // Clients can reach us from now on, this is our readiness point
+    startup_profile_add(STARTUP_PHASE_SERVICE, service_start);
+    gint64 startup = startup_profile_finish();
+    g_autofree gchar *report = startup_profile_report();
+    g_message("%s", report);
+    sd_notifyf(0, "READY=1\nSTATUS=Ready in %" G_GINT64_FORMAT " ms", startup / 1000);
 }
 
 static void name_lost_cb(GDBusConnection *connection, const gchar *name,
@@ -56,6 +68,8 @@ static void name_lost_cb(GDBusConnection *connection, const gchar *name,
 
 int main(int argc, char *argv[])
 {
+    startup_profile_begin();
+
     g_unix_signal_add(SIGTERM, quit_cb, NULL);
     g_unix_signal_add(SIGINT, quit_cb, NULL);
     main_loop = g_main_loop_new(NULL, FALSE);
@@ -70,12 +84,15 @@ int main(int argc, char *argv[])
 
     AppLauncher *launcher = app_launcher_get_default();
 
+    service_start = g_get_monotonic_time();
     gint owner_id = g_bus_own_name(G_BUS_TYPE_SESSION, APPLAUNCH_DBUS_NAME,
                                    G_BUS_NAME_OWNER_FLAGS_NONE, bus_acquired_cb,
                                    name_acquired_cb, name_lost_cb,
                                    launcher, NULL);
 
     g_main_loop_run(main_loop);
+
+    sd_notify(0, "STOPPING=1");
     g_main_loop_unref(main_loop);
 
     g_object_unref(launcher);
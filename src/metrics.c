@@ -0,0 +1,574 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// For lstat(), the project being built in strict C17 mode
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <gio/gunixsocketaddress.h>
+
+#include "metrics.h"
+
+/*
+ * Counters are split in cache line sized shards, each thread updating its
+ * own shard so that hot counters do not bounce between CPUs.
+ */
+#define METRICS_SHARDS 16
+
+typedef struct {
+    _Alignas(64) guint64 value;
+} MetricShard;
+
+struct _Metric {
+    gchar *name;
+    gchar *labels;
+    gchar *help;
+    MetricType type;
+    // Added by a collector, only lives for one enumeration
+    gboolean collected;
+
+    union {
+        MetricShard *shards;
+        gint64 gauge;
+        struct {
+            guint64 count;
+            guint64 sum;
+            guint64 max;
+            guint64 *buckets;
+        } histogram;
+    };
+};
+
+/* Only used for registration and enumeration, never for updates */
+static GMutex metrics_lock;
+static GPtrArray *metrics_list;
+
+typedef struct {
+    MetricsCollectorFunc func;
+    gpointer user_data;
+} MetricsCollector;
+
+/* Held while collectors run, so that a removed one is no longer running */
+static GMutex collectors_lock;
+static GArray *collectors;
+
+static guint metrics_shard(void)
+{
+    static _Thread_local gint shard = -1;
+    static gint next_shard;
+
+    if (shard < 0)
+        shard = g_atomic_int_add(&next_shard, 1) % METRICS_SHARDS;
+
+    return shard;
+}
+
+static Metric *metric_new(MetricType type, const gchar *name,
+                          const gchar *labels, const gchar *help)
+{
+    Metric *metric = g_new0(Metric, 1);
+
+    metric->name = g_strdup(name);
+    metric->labels = g_strdup(labels);
+    metric->help = g_strdup(help);
+    metric->type = type;
+
+    switch (type) {
+    case METRIC_TYPE_COUNTER:
+        metric->shards = aligned_alloc(_Alignof(MetricShard),
+                                       METRICS_SHARDS * sizeof(MetricShard));
+        memset(metric->shards, 0, METRICS_SHARDS * sizeof(MetricShard));
+        break;
+    case METRIC_TYPE_HISTOGRAM:
+        metric->histogram.buckets = g_new0(guint64, METRICS_HISTOGRAM_BUCKETS);
+        break;
+    default:
+        break;
+    }
+
+    return metric;
+}
+
+// Registered metrics are never freed, only the collected ones
+static void metric_free_collected(gpointer data)
+{
+    Metric *metric = data;
+
+    if (!metric->collected)
+        return;
+
+    switch (metric->type) {
+    case METRIC_TYPE_COUNTER:
+        free(metric->shards);
+        break;
+    case METRIC_TYPE_HISTOGRAM:
+        g_free(metric->histogram.buckets);
+        break;
+    default:
+        break;
+    }
+    g_free(metric->name);
+    g_free(metric->labels);
+    g_free(metric->help);
+    g_free(metric);
+}
+
+static Metric *metrics_get(MetricType type, const gchar *name,
+                           const gchar *labels, const gchar *help)
+{
+    Metric *metric = NULL;
+
+    g_mutex_lock(&metrics_lock);
+
+    if (!metrics_list)
+        metrics_list = g_ptr_array_new();
+
+    for (guint i = 0; i < metrics_list->len; i++) {
+        Metric *m = g_ptr_array_index(metrics_list, i);
+
+        if (g_strcmp0(m->name, name) == 0 && g_strcmp0(m->labels, labels) == 0) {
+            metric = m;
+            break;
+        }
+    }
+
+    if (metric) {
+        if (metric->type != type) {
+            g_critical("Metric '%s' registered with different types", name);
+            metric = NULL;
+        }
+        goto out;
+    }
+
+    metric = metric_new(type, name, labels, help);
+    g_ptr_array_add(metrics_list, metric);
+
+out:
+    g_mutex_unlock(&metrics_lock);
+
+    return metric;
+}
+
+Metric *metrics_counter(const gchar *name, const gchar *labels, const gchar *help)
+{
+    return metrics_get(METRIC_TYPE_COUNTER, name, labels, help);
+}
+
+Metric *metrics_gauge(const gchar *name, const gchar *labels, const gchar *help)
+{
+    return metrics_get(METRIC_TYPE_GAUGE, name, labels, help);
+}
+
+Metric *metrics_histogram(const gchar *name, const gchar *labels, const gchar *help)
+{
+    return metrics_get(METRIC_TYPE_HISTOGRAM, name, labels, help);
+}
+
+void metric_add(Metric *counter, guint64 value)
+{
+    g_return_if_fail(counter && counter->type == METRIC_TYPE_COUNTER);
+
+    __atomic_fetch_add(&counter->shards[metrics_shard()].value, value,
+                       __ATOMIC_RELAXED);
+}
+
+void metric_set(Metric *gauge, gint64 value)
+{
+    g_return_if_fail(gauge && gauge->type == METRIC_TYPE_GAUGE);
+
+    __atomic_store_n(&gauge->gauge, value, __ATOMIC_RELAXED);
+}
+
+static guint metrics_histogram_bucket(guint64 value)
+{
+    if (value < (1 << METRICS_HISTOGRAM_SUB_BITS))
+        return value;
+
+    if (value >> METRICS_HISTOGRAM_MAX_BITS)
+        return METRICS_HISTOGRAM_BUCKETS - 1;
+
+    // Position of the most significant bit, followed by the next bits
+    guint msb = 63 - __builtin_clzll(value);
+    guint shift = msb - METRICS_HISTOGRAM_SUB_BITS;
+    guint sub = (value >> shift) & ((1 << METRICS_HISTOGRAM_SUB_BITS) - 1);
+
+    return ((shift + 1) << METRICS_HISTOGRAM_SUB_BITS) + sub;
+}
+
+guint64 metrics_histogram_bucket_upper_bound(guint bucket)
+{
+    if (bucket < (1 << METRICS_HISTOGRAM_SUB_BITS))
+        return bucket;
+
+    guint shift = (bucket >> METRICS_HISTOGRAM_SUB_BITS) - 1;
+    guint64 sub = bucket & ((1 << METRICS_HISTOGRAM_SUB_BITS) - 1);
+    guint64 lower = ((1 << METRICS_HISTOGRAM_SUB_BITS) + sub) << shift;
+
+    return lower + (G_GUINT64_CONSTANT(1) << shift) - 1;
+}
+
+void metric_record(Metric *histogram, guint64 value)
+{
+    g_return_if_fail(histogram && histogram->type == METRIC_TYPE_HISTOGRAM);
+
+    __atomic_fetch_add(&histogram->histogram.buckets[metrics_histogram_bucket(value)],
+                       1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&histogram->histogram.count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&histogram->histogram.sum, value, __ATOMIC_RELAXED);
+
+    guint64 max = __atomic_load_n(&histogram->histogram.max, __ATOMIC_RELAXED);
+    while (value > max &&
+           !__atomic_compare_exchange_n(&histogram->histogram.max, &max, value, TRUE,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
+const gchar *metric_get_name(Metric *metric)
+{
+    return metric->name;
+}
+
+const gchar *metric_get_labels(Metric *metric)
+{
+    return metric->labels;
+}
+
+const gchar *metric_get_help(Metric *metric)
+{
+    return metric->help;
+}
+
+MetricType metric_get_type(Metric *metric)
+{
+    return metric->type;
+}
+
+gint64 metric_get_value(Metric *metric)
+{
+    guint64 value = 0;
+
+    switch (metric->type) {
+    case METRIC_TYPE_COUNTER:
+        for (guint i = 0; i < METRICS_SHARDS; i++)
+            value += __atomic_load_n(&metric->shards[i].value, __ATOMIC_RELAXED);
+        return value;
+    case METRIC_TYPE_GAUGE:
+        return __atomic_load_n(&metric->gauge, __ATOMIC_RELAXED);
+    default:
+        return 0;
+    }
+}
+
+/*
+ * Copy the histogram data. Concurrent updates may make the copy slightly
+ * inconsistent, but the count is then always derived from the buckets.
+ */
+void metric_get_histogram(Metric *histogram, MetricHistogramSnapshot *snapshot)
+{
+    g_return_if_fail(histogram && histogram->type == METRIC_TYPE_HISTOGRAM);
+
+    snapshot->count = 0;
+    for (guint i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+        snapshot->buckets[i] = __atomic_load_n(&histogram->histogram.buckets[i],
+                                               __ATOMIC_RELAXED);
+        snapshot->count += snapshot->buckets[i];
+    }
+    snapshot->sum = __atomic_load_n(&histogram->histogram.sum, __ATOMIC_RELAXED);
+    snapshot->max = __atomic_load_n(&histogram->histogram.max, __ATOMIC_RELAXED);
+}
+
+/*
+ * Estimate the given quantile (0 to 1) of the recorded values, with the
+ * precision of the buckets.
+ */
+guint64 metrics_histogram_quantile(const MetricHistogramSnapshot *snapshot,
+                                   gdouble quantile)
+{
+    guint64 rank = (guint64) (quantile * snapshot->count + 0.5);
+    guint64 seen = 0;
+
+    if (!snapshot->count)
+        return 0;
+
+    for (guint i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+        seen += snapshot->buckets[i];
+        if (seen >= MAX(rank, 1))
+            return MIN(metrics_histogram_bucket_upper_bound(i), snapshot->max);
+    }
+
+    return snapshot->max;
+}
+
+void metrics_add_collector(MetricsCollectorFunc func, gpointer user_data)
+{
+    MetricsCollector collector = { func, user_data };
+
+    g_mutex_lock(&collectors_lock);
+    if (!collectors)
+        collectors = g_array_new(FALSE, FALSE, sizeof(MetricsCollector));
+    g_array_append_val(collectors, collector);
+    g_mutex_unlock(&collectors_lock);
+}
+
+void metrics_remove_collector(MetricsCollectorFunc func, gpointer user_data)
+{
+    g_mutex_lock(&collectors_lock);
+    for (guint i = 0; collectors && i < collectors->len; i++) {
+        MetricsCollector *collector = &g_array_index(collectors, MetricsCollector, i);
+
+        if (collector->func == func && collector->user_data == user_data) {
+            g_array_remove_index(collectors, i);
+            break;
+        }
+    }
+    g_mutex_unlock(&collectors_lock);
+}
+
+void metrics_collected_add(GPtrArray *metrics, MetricType type, const gchar *name,
+                           const gchar *labels, const gchar *help, gint64 value)
+{
+    Metric *metric;
+
+    g_return_if_fail(type != METRIC_TYPE_HISTOGRAM);
+
+    metric = metric_new(type, name, labels, help);
+    metric->collected = TRUE;
+    if (type == METRIC_TYPE_COUNTER)
+        metric->shards[0].value = value;
+    else
+        metric->gauge = value;
+
+    g_ptr_array_add(metrics, metric);
+}
+
+gchar *metrics_format_label(const gchar *name, const gchar *value)
+{
+    GString *label = g_string_new(name);
+
+    g_string_append(label, "=\"");
+    for (const gchar *c = value; *c; c++) {
+        switch (*c) {
+        case '\\':
+            g_string_append(label, "\\\\");
+            break;
+        case '"':
+            g_string_append(label, "\\\"");
+            break;
+        case '\n':
+            g_string_append(label, "\\n");
+            break;
+        default:
+            g_string_append_c(label, *c);
+            break;
+        }
+    }
+    g_string_append_c(label, '"');
+
+    return g_string_free(label, FALSE);
+}
+
+/*
+ * List the registered metrics, followed by the ones of the collectors.
+ */
+static GPtrArray *metrics_list_all(void)
+{
+    GPtrArray *list = g_ptr_array_new_with_free_func(metric_free_collected);
+
+    // Registered metrics are never freed, walk a copy of the list without the lock
+    g_mutex_lock(&metrics_lock);
+    if (metrics_list)
+        g_ptr_array_extend(list, metrics_list, NULL, NULL);
+    g_mutex_unlock(&metrics_lock);
+
+    g_mutex_lock(&collectors_lock);
+    for (guint i = 0; collectors && i < collectors->len; i++) {
+        MetricsCollector *collector = &g_array_index(collectors, MetricsCollector, i);
+
+        collector->func(list, collector->user_data);
+    }
+    g_mutex_unlock(&collectors_lock);
+
+    return list;
+}
+
+/*
+ * Call `func` for each metric, in registration order, then for the ones
+ * of the collectors.
+ */
+void metrics_foreach(MetricsFunc func, gpointer user_data)
+{
+    g_autoptr(GPtrArray) list = metrics_list_all();
+
+    for (guint i = 0; i < list->len; i++)
+        func(g_ptr_array_index(list, i), user_data);
+}
+
+static void metrics_append_sample(GString *out, const gchar *name,
+                                  const gchar *suffix, const gchar *labels,
+                                  const gchar *extra_label, guint64 value)
+{
+    g_string_append_printf(out, "%s%s", name, suffix);
+    if (labels || extra_label) {
+        g_string_append_printf(out, "{%s%s%s}",
+                               labels ? labels : "",
+                               labels && extra_label ? "," : "",
+                               extra_label ? extra_label : "");
+    }
+    g_string_append_printf(out, " %" G_GUINT64_FORMAT "\n", value);
+}
+
+static void metrics_append_openmetrics(GString *out, Metric *metric)
+{
+    switch (metric->type) {
+    case METRIC_TYPE_COUNTER:
+        metrics_append_sample(out, metric->name, "_total", metric->labels, NULL,
+                              metric_get_value(metric));
+        break;
+    case METRIC_TYPE_GAUGE:
+        g_string_append(out, metric->name);
+        if (metric->labels)
+            g_string_append_printf(out, "{%s}", metric->labels);
+        g_string_append_printf(out, " %" G_GINT64_FORMAT "\n", metric_get_value(metric));
+        break;
+    case METRIC_TYPE_HISTOGRAM: {
+        g_autofree MetricHistogramSnapshot *snapshot = g_new(MetricHistogramSnapshot, 1);
+        guint64 cumulative = 0;
+
+        // Only list the buckets holding values, the rest is implied
+        metric_get_histogram(metric, snapshot);
+        for (guint i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+            if (!snapshot->buckets[i])
+                continue;
+
+            g_autofree gchar *le = g_strdup_printf("le=\"%" G_GUINT64_FORMAT "\"",
+                                                   metrics_histogram_bucket_upper_bound(i));
+            cumulative += snapshot->buckets[i];
+            metrics_append_sample(out, metric->name, "_bucket", metric->labels, le,
+                                  cumulative);
+        }
+        metrics_append_sample(out, metric->name, "_bucket", metric->labels,
+                              "le=\"+Inf\"", snapshot->count);
+        metrics_append_sample(out, metric->name, "_count", metric->labels, NULL,
+                              snapshot->count);
+        metrics_append_sample(out, metric->name, "_sum", metric->labels, NULL,
+                              snapshot->sum);
+        break;
+    }
+    }
+}
+
+static const gchar *metric_type_names[] = {
+    [METRIC_TYPE_COUNTER] = "counter",
+    [METRIC_TYPE_GAUGE] = "gauge",
+    [METRIC_TYPE_HISTOGRAM] = "histogram",
+};
+
+/*
+ * Render all metrics in the OpenMetrics text format, metrics sharing the
+ * same name being grouped in a single family.
+ */
+gchar *metrics_to_openmetrics(void)
+{
+    g_autoptr(GPtrArray) list = metrics_list_all();
+    g_autoptr(GHashTable) done = g_hash_table_new(g_str_hash, g_str_equal);
+    GString *out = g_string_new(NULL);
+
+    for (guint i = 0; i < list->len; i++) {
+        Metric *family = g_ptr_array_index(list, i);
+
+        if (!g_hash_table_add(done, family->name))
+            continue;
+
+        g_string_append_printf(out, "# TYPE %s %s\n", family->name,
+                               metric_type_names[family->type]);
+        if (family->help)
+            g_string_append_printf(out, "# HELP %s %s\n", family->name, family->help);
+
+        for (guint j = i; j < list->len; j++) {
+            Metric *metric = g_ptr_array_index(list, j);
+
+            if (g_strcmp0(metric->name, family->name) == 0)
+                metrics_append_openmetrics(out, metric);
+        }
+    }
+    g_string_append(out, "# EOF\n");
+
+    return g_string_free(out, FALSE);
+}
+
+/*
+ * Serve a single HTTP request with the current metrics, runs in a
+ * worker thread of the socket service.
+ */
+static gboolean metrics_exporter_run_cb(GThreadedSocketService *service,
+                                        GSocketConnection *connection,
+                                        GObject *source_object,
+                                        gpointer user_data)
+{
+    GInputStream *input = g_io_stream_get_input_stream(G_IO_STREAM(connection));
+    GOutputStream *output = g_io_stream_get_output_stream(G_IO_STREAM(connection));
+    g_autoptr(GDataInputStream) request = g_data_input_stream_new(input);
+    g_autoptr(GError) error = NULL;
+
+    g_socket_set_timeout(g_socket_connection_get_socket(connection), 5);
+    g_filter_input_stream_set_close_base_stream(G_FILTER_INPUT_STREAM(request), FALSE);
+
+    // Skip the request headers, whatever the request we send the metrics
+    for (;;) {
+        g_autofree gchar *line = g_data_input_stream_read_line(request, NULL, NULL, &error);
+
+        if (!line) {
+            if (error)
+                g_debug("Failed to read metrics request: %s", error->message);
+            return FALSE;
+        }
+        g_strchomp(line);
+        if (!*line)
+            break;
+    }
+
+    g_autofree gchar *body = metrics_to_openmetrics();
+    g_autofree gchar *header =
+        g_strdup_printf("HTTP/1.0 200 OK\r\n"
+                        "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+                        "Content-Length: %zu\r\n"
+                        "\r\n", strlen(body));
+
+    if (!g_output_stream_write_all(output, header, strlen(header), NULL, NULL, &error) ||
+        !g_output_stream_write_all(output, body, strlen(body), NULL, NULL, &error))
+        g_debug("Failed to send metrics: %s", error->message);
+
+    return FALSE;
+}
+
+/*
+ * Create a service exposing the metrics over HTTP on the given Unix
+ * socket, e.g. for `curl --unix-socket PATH http://localhost/metrics`.
+ */
+GSocketService *metrics_exporter_new(const gchar *path, GError **error)
+{
+    g_autoptr(GSocketAddress) address = g_unix_socket_address_new(path);
+    GSocketService *service = g_threaded_socket_service_new(2);
+    struct stat st;
+
+    // Remove the socket of a previous instance, but nothing else
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(path);
+
+    if (!g_socket_listener_add_address(G_SOCKET_LISTENER(service), address,
+                                       G_SOCKET_TYPE_STREAM, G_SOCKET_PROTOCOL_DEFAULT,
+                                       NULL, NULL, error)) {
+        g_object_unref(service);
+        return NULL;
+    }
+
+    g_signal_connect(service, "run", G_CALLBACK(metrics_exporter_run_cb), NULL);
+    g_socket_service_start(service);
+
+    return service;
+}
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+typedef enum {
+    METRIC_TYPE_COUNTER,
+    METRIC_TYPE_GAUGE,
+    METRIC_TYPE_HISTOGRAM
+} MetricType;
+
+/*
+ * Metrics are registered once and live as long as the process, updating
+ * them is lock-free and may be done from any thread.
+ */
+typedef struct _Metric Metric;
+
+/*
+ * Histograms have log-linear buckets: values below 16 are exact, larger
+ * ones are recorded with a relative precision of 1/16, up to 2^36.
+ */
+#define METRICS_HISTOGRAM_SUB_BITS 4
+#define METRICS_HISTOGRAM_MAX_BITS 36
+#define METRICS_HISTOGRAM_BUCKETS \
+    ((METRICS_HISTOGRAM_MAX_BITS - METRICS_HISTOGRAM_SUB_BITS + 1) << METRICS_HISTOGRAM_SUB_BITS)
+
+typedef struct {
+    guint64 count;
+    guint64 sum;
+    guint64 max;
+    guint64 buckets[METRICS_HISTOGRAM_BUCKETS];
+} MetricHistogramSnapshot;
+
+typedef void (*MetricsFunc)(Metric *metric, gpointer user_data);
+
+/*
+ * Get the metric with the given name and labels (as in the OpenMetrics
+ * text format, e.g. `method="StartUnit"`, or NULL), registering it on
+ * first use.
+ */
+Metric *metrics_counter(const gchar *name, const gchar *labels, const gchar *help);
+Metric *metrics_gauge(const gchar *name, const gchar *labels, const gchar *help);
+Metric *metrics_histogram(const gchar *name, const gchar *labels, const gchar *help);
+
+void metric_add(Metric *counter, guint64 value);
+#define metric_inc(counter) metric_add(counter, 1)
+
+void metric_set(Metric *gauge, gint64 value);
+
+void metric_record(Metric *histogram, guint64 value);
+
+/* Accessors */
+const gchar *metric_get_name(Metric *metric);
+const gchar *metric_get_labels(Metric *metric);
+const gchar *metric_get_help(Metric *metric);
+MetricType metric_get_type(Metric *metric);
+
+/* Counter total or gauge value */
+gint64 metric_get_value(Metric *metric);
+
+void metric_get_histogram(Metric *histogram, MetricHistogramSnapshot *snapshot);
+
+guint64 metrics_histogram_bucket_upper_bound(guint bucket);
+guint64 metrics_histogram_quantile(const MetricHistogramSnapshot *snapshot,
+                                   gdouble quantile);
+
+/*
+ * Collectors provide metrics that only exist for a while, e.g. one per
+ * client, and are called from any thread each time the metrics are
+ * enumerated: they add the current values to `metrics` with
+ * metrics_collected_add(). Once removed, a collector is no longer running.
+ */
+typedef void (*MetricsCollectorFunc)(GPtrArray *metrics, gpointer user_data);
+
+void metrics_add_collector(MetricsCollectorFunc func, gpointer user_data);
+void metrics_remove_collector(MetricsCollectorFunc func, gpointer user_data);
+
+/* Counters and gauges only */
+void metrics_collected_add(GPtrArray *metrics, MetricType type, const gchar *name,
+                           const gchar *labels, const gchar *help, gint64 value);
+
+/* Format a label, e.g. `peer="unix:"`, escaping its value */
+gchar *metrics_format_label(const gchar *name, const gchar *value);
+
+void metrics_foreach(MetricsFunc func, gpointer user_data);
+
+gchar *metrics_to_openmetrics(void);
+
+GSocketService *metrics_exporter_new(const gchar *path, GError **error);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include "probes.h"
+
+/*
+ * The probe semaphores, as `dtrace -G` would generate them. They stay 0
+ * unless a tracer attaches to their probe.
+ */
+#ifdef APPLAUNCHD_HAVE_PROBES
+#define APPLAUNCHD_DEFINE_SEMAPHORE(name) \
+    unsigned short APPLAUNCHD_PROBE_SEMAPHORE(name) __attribute__((section(".probes")));
+
+APPLAUNCHD_PROBES(APPLAUNCHD_DEFINE_SEMAPHORE)
+#endif
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef PROBES_H
+#define PROBES_H
+
+/*
+ * USDT probes of the "applaunchd" provider. They are a single nop until a
+ * tracer attaches to them, e.g. list them with
+ * `bpftrace -l 'usdt:/usr/bin/applaunchd:*'`, and compile to nothing when
+ * the systemtap SDT header is not available. See scripts/bpftrace for
+ * examples.
+ *
+ * String arguments are passed as `const char *`, statuses as the AppStatus
+ * and AppState enum values and unit states as the UnitState ones.
+ *
+ * Each probe has a semaphore, which tracers increment while attached to it:
+ * guard arguments that are not free to evaluate with
+ * APPLAUNCHD_PROBE_ENABLED(), they are otherwise computed on every pass.
+ * New probes must be added to APPLAUNCHD_PROBES() for their semaphore to be
+ * defined, in probes.c.
+ */
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+#define APPLAUNCHD_HAVE_PROBES 1
+#endif
+#endif
+
+#define APPLAUNCHD_PROBES(X) \
+    X(catalog__enumerate__begin) \
+    X(catalog__enumerate__end) \
+    X(catalog__build__end) \
+    X(catalog__publish) \
+    X(unit__transition) \
+    X(start__app__begin) \
+    X(start__app__end) \
+    X(rpc__entry) \
+    X(rpc__exit) \
+    X(status__fanout__begin) \
+    X(status__send) \
+    X(status__fanout__end) \
+    X(stream__write)
+
+#ifdef APPLAUNCHD_HAVE_PROBES
+#define APPLAUNCHD_PROBE_SEMAPHORE(name) applaunchd_##name##_semaphore
+#define APPLAUNCHD_DECLARE_SEMAPHORE(name) \
+    extern unsigned short APPLAUNCHD_PROBE_SEMAPHORE(name) \
+        __attribute__((section(".probes")));
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+APPLAUNCHD_PROBES(APPLAUNCHD_DECLARE_SEMAPHORE)
+#ifdef __cplusplus
+}
+#endif
+
+#define APPLAUNCHD_PROBE_ENABLED(name) __builtin_expect(APPLAUNCHD_PROBE_SEMAPHORE(name), 0)
+#define APPLAUNCHD_PROBE0(name) DTRACE_PROBE(applaunchd, name)
+#define APPLAUNCHD_PROBE1(name, a1) DTRACE_PROBE1(applaunchd, name, a1)
+#define APPLAUNCHD_PROBE2(name, a1, a2) DTRACE_PROBE2(applaunchd, name, a1, a2)
+#define APPLAUNCHD_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(applaunchd, name, a1, a2, a3)
+#define APPLAUNCHD_PROBE4(name, a1, a2, a3, a4) DTRACE_PROBE4(applaunchd, name, a1, a2, a3, a4)
+#else
+#define APPLAUNCHD_PROBE_ENABLED(name) 0
+#define APPLAUNCHD_PROBE0(name) do {} while (0)
+#define APPLAUNCHD_PROBE1(name, a1) do {} while (0)
+#define APPLAUNCHD_PROBE2(name, a1, a2) do {} while (0)
+#define APPLAUNCHD_PROBE3(name, a1, a2, a3) do {} while (0)
+#define APPLAUNCHD_PROBE4(name, a1, a2, a3, a4) do {} while (0)
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// For CLOCK_BOOTTIME, the project being built in strict C17 mode
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "startup_profile.h"
+#include "metrics.h"
+
+static const gchar *startup_phase_names[STARTUP_PHASE_COUNT] = {
+    [STARTUP_PHASE_EXEC] = "exec",
+    [STARTUP_PHASE_BUS_CONNECT] = "bus_connect",
+    [STARTUP_PHASE_STATE_RESTORE] = "state_restore",
+    [STARTUP_PHASE_UNIT_ENUMERATION] = "unit_enumeration",
+    [STARTUP_PHASE_UNIT_DESCRIPTIONS] = "unit_descriptions",
+    [STARTUP_PHASE_ICON_SEARCH] = "icon_search",
+    [STARTUP_PHASE_SUBSCRIBE] = "subscribe",
+    [STARTUP_PHASE_SERVICE] = "service",
+};
+
+static gint64 startup_begin;
+static gint64 startup_end;
+static gint64 startup_phases[STARTUP_PHASE_COUNT];
+
+/*
+ * Time elapsed since the process was created, in microseconds, or 0 if
+ * unknown. The kernel only records the start time in clock ticks, so this
+ * has a 10ms resolution on most systems.
+ */
+static gint64 startup_process_age(void)
+{
+    g_autofree gchar *contents = NULL;
+    if (!g_file_get_contents("/proc/self/stat", &contents, NULL, NULL))
+        return 0;
+
+    // Skip the command name, which may contain spaces, then fields 3 to 21
+    gchar *p = strrchr(contents, ')');
+    unsigned long long starttime;
+    if (!p || sscanf(p + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u "
+                     "%*d %*d %*d %*d %*d %*d %llu", &starttime) != 1)
+        return 0;
+
+    // The start time is relative to boot, including suspend
+    struct timespec now;
+    if (clock_gettime(CLOCK_BOOTTIME, &now) < 0)
+        return 0;
+
+    long ticks = sysconf(_SC_CLK_TCK);
+    if (ticks <= 0)
+        return 0;
+
+    gint64 age = (gint64) now.tv_sec * G_USEC_PER_SEC + now.tv_nsec / 1000 -
+                 (gint64) (starttime * G_USEC_PER_SEC / ticks);
+
+    return MAX(age, 0);
+}
+
+void startup_profile_begin(void)
+{
+    startup_begin = g_get_monotonic_time();
+    startup_phases[STARTUP_PHASE_EXEC] = startup_process_age();
+}
+
+void startup_profile_add(StartupPhase phase, gint64 start)
+{
+    g_return_if_fail(phase < STARTUP_PHASE_COUNT);
+
+    if (!startup_begin || startup_end)
+        return;
+
+    startup_phases[phase] += g_get_monotonic_time() - start;
+}
+
+gint64 startup_profile_finish(void)
+{
+    g_return_val_if_fail(startup_begin != 0, 0);
+
+    if (startup_end)
+        return startup_end - startup_begin + startup_phases[STARTUP_PHASE_EXEC];
+
+    startup_end = g_get_monotonic_time();
+
+    for (guint i = 0; i < STARTUP_PHASE_COUNT; i++) {
+        g_autofree gchar *labels = g_strdup_printf("phase=\"%s\"", startup_phase_names[i]);
+        metric_set(metrics_gauge("applaunchd_startup_phase_duration_microseconds", labels,
+                                 "Time spent in each phase of the daemon startup"),
+                   startup_phases[i]);
+    }
+
+    gint64 total = startup_end - startup_begin + startup_phases[STARTUP_PHASE_EXEC];
+    metric_set(metrics_gauge("applaunchd_startup_duration_microseconds", NULL,
+                             "Time from process creation to the daemon being ready"),
+               total);
+
+    return total;
+}
+
+gchar *startup_profile_report(void)
+{
+    GString *out = g_string_new("Startup profile:\n");
+    gint64 end = startup_end ? startup_end : g_get_monotonic_time();
+    gint64 total = end - startup_begin + startup_phases[STARTUP_PHASE_EXEC];
+    gint64 accounted = 0;
+
+    for (guint i = 0; i < STARTUP_PHASE_COUNT; i++) {
+        accounted += startup_phases[i];
+        g_string_append_printf(out, "  %-20s %9.3f ms %5.1f%%\n", startup_phase_names[i],
+                               startup_phases[i] / 1000.0,
+                               total ? 100.0 * startup_phases[i] / total : 0.0);
+    }
+    // Whatever happened between the phases, e.g. option parsing
+    g_string_append_printf(out, "  %-20s %9.3f ms\n", "other",
+                           MAX(total - accounted, 0) / 1000.0);
+    g_string_append_printf(out, "  %-20s %9.3f ms", "total", total / 1000.0);
+
+    return g_string_free(out, FALSE);
+}
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef STARTUPPROFILE_H
+#define STARTUPPROFILE_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Phases of the daemon startup. Phases which run once per unit, such as
+ * fetching descriptions and looking up icons, are accumulated.
+ */
+typedef enum {
+    // From process creation to main(), i.e. loading and static constructors
+    STARTUP_PHASE_EXEC,
+    STARTUP_PHASE_BUS_CONNECT,
+    // Loading the state handed over by a previous instance, if any
+    STARTUP_PHASE_STATE_RESTORE,
+    STARTUP_PHASE_UNIT_ENUMERATION,
+    STARTUP_PHASE_UNIT_DESCRIPTIONS,
+    STARTUP_PHASE_ICON_SEARCH,
+    STARTUP_PHASE_SUBSCRIBE,
+    // Exporting the API, either the gRPC server or the D-Bus name
+    STARTUP_PHASE_SERVICE,
+    STARTUP_PHASE_COUNT
+} StartupPhase;
+
+/*
+ * The startup profile is only meant to be used from the main thread. All
+ * timestamps are CLOCK_MONOTONIC microseconds as returned by
+ * g_get_monotonic_time().
+ */
+
+/*
+ * Start profiling, to be called first thing in main().
+ */
+void startup_profile_begin(void);
+
+/*
+ * Account the time elapsed since start to the given phase. Does nothing
+ * once startup is complete, so that later catalog refreshes don't count.
+ */
+void startup_profile_add(StartupPhase phase, gint64 start);
+
+/*
+ * Complete the startup, publishing the phase durations as metrics.
+ * Returns the total startup time in microseconds.
+ */
+gint64 startup_profile_finish(void);
+
+/*
+ * Render a human-readable report of the startup phases.
+ */
+gchar *startup_profile_report(void);
+
+G_END_DECLS
+
+#endif
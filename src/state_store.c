@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// For memfd_create(), the project being built in strict C17 mode
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <systemd/sd-daemon.h>
+
+#include "state_store.h"
+
+#define STATE_STORE_MAGIC "ALDSTATE"
+
+/*
+ * The memfd holds this header followed by the serialized state, wrapped in
+ * a variant so that it carries its own type. The digest catches a state
+ * torn by a crash in the middle of a save.
+ */
+typedef struct {
+    gchar magic[8];
+    guint64 size;
+    guint8 digest[32];
+} StateHeader;
+
+struct _StateStore {
+    int fd;
+};
+
+static void state_digest(gconstpointer data, gsize size, guint8 digest[32])
+{
+    GChecksum *checksum = g_checksum_new(G_CHECKSUM_SHA256);
+    gsize len = 32;
+
+    g_checksum_update(checksum, data, size);
+    g_checksum_get_digest(checksum, digest, &len);
+    g_checksum_free(checksum);
+}
+
+StateStore *state_store_new(int fd)
+{
+    if (fd < 0) {
+        fd = memfd_create("applaunchd-state", MFD_CLOEXEC);
+        if (fd < 0) {
+            g_warning("Failed to create state memfd: %s", g_strerror(errno));
+            return NULL;
+        }
+
+        int ret = sd_pid_notify_with_fds(0, 0, "FDSTORE=1\nFDNAME=" STATE_STORE_FDNAME, &fd, 1);
+        if (ret <= 0) {
+            if (ret < 0)
+                g_warning("Failed to hand state memfd to systemd: %s", g_strerror(-ret));
+            close(fd);
+            return NULL;
+        }
+    }
+
+    StateStore *self = g_new0(StateStore, 1);
+    self->fd = fd;
+
+    return self;
+}
+
+GVariant *state_store_load(StateStore *self, const GVariantType *type)
+{
+    g_return_val_if_fail(self != NULL, NULL);
+
+    StateHeader header;
+    if (pread(self->fd, &header, sizeof(header), 0) != sizeof(header))
+        return NULL;
+
+    if (memcmp(header.magic, STATE_STORE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.size > G_MAXSIZE - sizeof(header)) {
+        g_warning("Ignoring invalid saved state");
+        return NULL;
+    }
+
+    gsize size = header.size;
+    gpointer data = g_malloc(size ? size : 1);
+    if (pread(self->fd, data, size, sizeof(header)) != (gssize) size) {
+        g_warning("Ignoring truncated saved state");
+        g_free(data);
+        return NULL;
+    }
+
+    guint8 digest[32];
+    state_digest(data, size, digest);
+    if (memcmp(digest, header.digest, sizeof(digest)) != 0) {
+        g_warning("Ignoring corrupted saved state");
+        g_free(data);
+        return NULL;
+    }
+
+    GBytes *bytes = g_bytes_new_take(data, size);
+    GVariant *wrapper = g_variant_ref_sink(g_variant_new_from_bytes(G_VARIANT_TYPE_VARIANT,
+                                                                    bytes, FALSE));
+    GVariant *state = g_variant_get_variant(wrapper);
+    g_variant_unref(wrapper);
+    g_bytes_unref(bytes);
+
+    if (!g_variant_is_of_type(state, type)) {
+        g_warning("Ignoring saved state of type %s, expected %s",
+                  g_variant_get_type_string(state), g_variant_type_peek_string(type));
+        g_variant_unref(state);
+        return NULL;
+    }
+
+    return state;
+}
+
+gboolean state_store_save(StateStore *self, GVariant *state)
+{
+    g_return_val_if_fail(self != NULL, FALSE);
+
+    GVariant *wrapper = g_variant_ref_sink(g_variant_new_variant(state));
+    gsize size = g_variant_get_size(wrapper);
+    gconstpointer data = g_variant_get_data(wrapper);
+
+    StateHeader header;
+    memcpy(header.magic, STATE_STORE_MAGIC, sizeof(header.magic));
+    header.size = size;
+    state_digest(data, size, header.digest);
+
+    // Shrinking first means a torn save can't be mistaken for a valid one
+    gboolean ret = ftruncate(self->fd, 0) == 0 &&
+                   pwrite(self->fd, data, size, sizeof(header)) == (gssize) size &&
+                   pwrite(self->fd, &header, sizeof(header), 0) == sizeof(header);
+    if (!ret)
+        g_warning("Failed to save state: %s", g_strerror(errno));
+
+    g_variant_unref(wrapper);
+
+    return ret;
+}
+
+void state_store_free(StateStore *self)
+{
+    if (!self)
+        return;
+
+    // systemd keeps its own reference to the memfd
+    close(self->fd);
+    g_free(self);
+}
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef STATESTORE_H
+#define STATESTORE_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Daemon state kept in systemd's file descriptor store, so that a restarted
+ * instance (upgrade, crash, watchdog) can pick up where the previous one
+ * left off. The state lives in a memfd which systemd holds on to, and which
+ * is rewritten in place on every save, so even a crash only loses the
+ * changes made since the last save.
+ *
+ * The service needs FileDescriptorStoreMax= to be set for this to work.
+ */
+
+// Name of the state file descriptor in the store
+#define STATE_STORE_FDNAME "state"
+
+typedef struct _StateStore StateStore;
+
+/*
+ * Use the state memfd passed by systemd, or create a new one and hand it
+ * to systemd if fd is -1. Returns NULL if we are not running under systemd
+ * or the memfd can't be created.
+ */
+StateStore *state_store_new(int fd);
+
+/*
+ * Load the saved state, NULL if there is none or it is not of the
+ * expected type.
+ */
+GVariant *state_store_load(StateStore *self, const GVariantType *type);
+
+/*
+ * Replace the saved state, consuming it if floating.
+ */
+gboolean state_store_save(StateStore *self, GVariant *state);
+
+void state_store_free(StateStore *self);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include "systemd1_client.h"
+
+#define SYSTEMD1_PATH "/org/freedesktop/systemd1"
+#define SYSTEMD1_MANAGER_INTERFACE "org.freedesktop.systemd1.Manager"
+#define SYSTEMD1_UNIT_INTERFACE "org.freedesktop.systemd1.Unit"
+#define PROPERTIES_INTERFACE "org.freedesktop.DBus.Properties"
+
+/*
+ * Messages are built and parsed with the GVariant constructors and
+ * accessors for their known types rather than from format strings, which
+ * would be parsed again on every call, and replies are type checked by
+ * GDBus against constant types.
+ */
+
+struct _Systemd1Unit {
+    GDBusConnection *conn;
+    guint subscription_id;
+
+    UnitState active_state;
+    guint64 inactive_exit_timestamp;
+    guint64 active_enter_timestamp;
+
+    Systemd1UnitChangedFunc callback;
+    gpointer user_data;
+};
+
+static GVariant *systemd1_manager_call(GDBusConnection *conn,
+                                       const gchar *bus_name,
+                                       const gchar *method,
+                                       GVariant *parameters,
+                                       const GVariantType *reply_type,
+                                       GError **error)
+{
+    return g_dbus_connection_call_sync(conn,
+                                       bus_name,
+                                       SYSTEMD1_PATH,
+                                       SYSTEMD1_MANAGER_INTERFACE,
+                                       method,
+                                       parameters,
+                                       reply_type,
+                                       G_DBUS_CALL_FLAGS_NONE,
+                                       -1,
+                                       NULL,
+                                       error);
+}
+
+gboolean systemd1_manager_list_unit_files_by_patterns(GDBusConnection *conn,
+                                                      const gchar *bus_name,
+                                                      const gchar *const *states,
+                                                      const gchar *const *patterns,
+                                                      GVariant **unit_files,
+                                                      GError **error)
+{
+    GVariant *args[] = {
+        g_variant_new_strv(states, -1),
+        g_variant_new_strv(patterns, -1),
+    };
+    GVariant *reply = systemd1_manager_call(conn, bus_name, "ListUnitFilesByPatterns",
+                                            g_variant_new_tuple(args, G_N_ELEMENTS(args)),
+                                            G_VARIANT_TYPE("(a(ss))"), error);
+    if (!reply)
+        return FALSE;
+
+    *unit_files = g_variant_get_child_value(reply, 0);
+    g_variant_unref(reply);
+
+    return TRUE;
+}
+
+gboolean systemd1_manager_start_unit(GDBusConnection *conn,
+                                     const gchar *bus_name,
+                                     const gchar *name,
+                                     const gchar *mode,
+                                     gchar **job,
+                                     GError **error)
+{
+    GVariant *args[] = {
+        g_variant_new_string(name),
+        g_variant_new_string(mode),
+    };
+    GVariant *reply = systemd1_manager_call(conn, bus_name, "StartUnit",
+                                            g_variant_new_tuple(args, G_N_ELEMENTS(args)),
+                                            G_VARIANT_TYPE("(o)"), error);
+    if (!reply)
+        return FALSE;
+
+    if (job) {
+        GVariant *path = g_variant_get_child_value(reply, 0);
+        *job = g_variant_dup_string(path, NULL);
+        g_variant_unref(path);
+    }
+    g_variant_unref(reply);
+
+    return TRUE;
+}
+
+gboolean systemd1_manager_subscribe(GDBusConnection *conn,
+                                    const gchar *bus_name,
+                                    GError **error)
+{
+    GVariant *reply = systemd1_manager_call(conn, bus_name, "Subscribe", NULL,
+                                            G_VARIANT_TYPE_UNIT, error);
+    if (!reply)
+        return FALSE;
+
+    g_variant_unref(reply);
+
+    return TRUE;
+}
+
+guint systemd1_manager_signal_subscribe(GDBusConnection *conn,
+                                        const gchar *bus_name,
+                                        const gchar *member,
+                                        GDBusSignalCallback callback,
+                                        gpointer user_data)
+{
+    return g_dbus_connection_signal_subscribe(conn,
+                                              bus_name,
+                                              SYSTEMD1_MANAGER_INTERFACE,
+                                              member,
+                                              SYSTEMD1_PATH,
+                                              NULL,
+                                              G_DBUS_SIGNAL_FLAGS_NONE,
+                                              callback,
+                                              user_data,
+                                              NULL);
+}
+
+GVariant *systemd1_get_property(GDBusConnection *conn,
+                                const gchar *bus_name,
+                                const gchar *object_path,
+                                const gchar *interface_name,
+                                const gchar *property_name,
+                                const GVariantType *type,
+                                GError **error)
+{
+    GVariant *args[] = {
+        g_variant_new_string(interface_name),
+        g_variant_new_string(property_name),
+    };
+    GVariant *reply = g_dbus_connection_call_sync(conn,
+                                                  bus_name,
+                                                  object_path,
+                                                  PROPERTIES_INTERFACE,
+                                                  "Get",
+                                                  g_variant_new_tuple(args, G_N_ELEMENTS(args)),
+                                                  G_VARIANT_TYPE("(v)"),
+                                                  G_DBUS_CALL_FLAGS_NONE,
+                                                  -1,
+                                                  NULL,
+                                                  error);
+    if (!reply)
+        return NULL;
+
+    GVariant *boxed = g_variant_get_child_value(reply, 0);
+    GVariant *value = g_variant_get_variant(boxed);
+    g_variant_unref(boxed);
+    g_variant_unref(reply);
+
+    if (!g_variant_is_of_type(value, type)) {
+        g_set_error(error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_SIGNATURE,
+                    "Unexpected type '%s' for property %s",
+                    g_variant_get_type_string(value), property_name);
+        g_variant_unref(value);
+        return NULL;
+    }
+
+    return value;
+}
+
+static void systemd1_unit_update_timestamp(GVariant *changed_properties,
+                                           const gchar *name,
+                                           guint64 *timestamp)
+{
+    GVariant *value = g_variant_lookup_value(changed_properties, name, G_VARIANT_TYPE_UINT64);
+
+    if (value) {
+        *timestamp = g_variant_get_uint64(value);
+        g_variant_unref(value);
+    }
+}
+
+static void systemd1_unit_properties_changed_cb(GDBusConnection *conn,
+                                                const gchar *sender_name,
+                                                const gchar *object_path,
+                                                const gchar *interface_name,
+                                                const gchar *signal_name,
+                                                GVariant *parameters,
+                                                gpointer user_data)
+{
+    Systemd1Unit *unit = user_data;
+
+    if (!g_variant_is_of_type(parameters, G_VARIANT_TYPE("(sa{sv}as)")))
+        return;
+
+    /*
+     * systemd sends the new values of the properties we follow, so the
+     * invalidated ones can be ignored.
+     */
+    GVariant *changed = g_variant_get_child_value(parameters, 1);
+    GVariant *active_state = g_variant_lookup_value(changed, "ActiveState",
+                                                    G_VARIANT_TYPE_STRING);
+    systemd1_unit_update_timestamp(changed, "InactiveExitTimestampMonotonic",
+                                   &unit->inactive_exit_timestamp);
+    systemd1_unit_update_timestamp(changed, "ActiveEnterTimestampMonotonic",
+                                   &unit->active_enter_timestamp);
+    g_variant_unref(changed);
+
+    if (!active_state)
+        return;
+
+    unit->active_state = unit_state_from_string(g_variant_get_string(active_state, NULL));
+    g_variant_unref(active_state);
+
+    // Last, as this may free the unit
+    unit->callback(unit, unit->user_data);
+}
+
+/*
+ * Start following the state of the unit at `object_path`, only fetching its
+ * ActiveState: the other properties we follow only matter once it changes.
+ */
+Systemd1Unit *systemd1_unit_new(GDBusConnection *conn,
+                                const gchar *bus_name,
+                                const gchar *object_path,
+                                Systemd1UnitChangedFunc callback,
+                                gpointer user_data,
+                                GError **error)
+{
+    Systemd1Unit *unit = g_new0(Systemd1Unit, 1);
+
+    unit->conn = g_object_ref(conn);
+    unit->callback = callback;
+    unit->user_data = user_data;
+
+    // Subscribe first, so that no change is missed
+    unit->subscription_id = g_dbus_connection_signal_subscribe(conn,
+                                                               bus_name,
+                                                               PROPERTIES_INTERFACE,
+                                                               "PropertiesChanged",
+                                                               object_path,
+                                                               SYSTEMD1_UNIT_INTERFACE,
+                                                               G_DBUS_SIGNAL_FLAGS_NONE,
+                                                               systemd1_unit_properties_changed_cb,
+                                                               unit,
+                                                               NULL);
+
+    GVariant *active_state = systemd1_get_property(conn, bus_name, object_path,
+                                                   SYSTEMD1_UNIT_INTERFACE, "ActiveState",
+                                                   G_VARIANT_TYPE_STRING, error);
+    if (!active_state) {
+        systemd1_unit_free(unit);
+        return NULL;
+    }
+    unit->active_state = unit_state_from_string(g_variant_get_string(active_state, NULL));
+    g_variant_unref(active_state);
+
+    return unit;
+}
+
+/*
+ * Stop following the unit. This may be called from its own callback, GDBus
+ * not delivering signals to a subscription once it's removed.
+ */
+void systemd1_unit_free(Systemd1Unit *unit)
+{
+    if (!unit)
+        return;
+
+    g_dbus_connection_signal_unsubscribe(unit->conn, unit->subscription_id);
+    g_object_unref(unit->conn);
+    g_free(unit);
+}
+
+UnitState systemd1_unit_get_active_state(Systemd1Unit *unit)
+{
+    return unit->active_state;
+}
+
+guint64 systemd1_unit_get_inactive_exit_timestamp_monotonic(Systemd1Unit *unit)
+{
+    return unit->inactive_exit_timestamp;
+}
+
+guint64 systemd1_unit_get_active_enter_timestamp_monotonic(Systemd1Unit *unit)
+{
+    return unit->active_enter_timestamp;
+}
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef SYSTEMD1CLIENT_H
+#define SYSTEMD1CLIENT_H
+
+#include <gio/gio.h>
+
+#include "app_state.h"
+
+G_BEGIN_DECLS
+
+/*
+ * Minimal client for the few parts of the org.freedesktop.systemd1 API we
+ * use. All calls are synchronous and take the connection to systemd along
+ * with its bus name, NULL on a peer-to-peer connection.
+ */
+
+#define SYSTEMD1_BUS_NAME "org.freedesktop.systemd1"
+
+gboolean systemd1_manager_list_unit_files_by_patterns(GDBusConnection *conn,
+                                                      const gchar *bus_name,
+                                                      const gchar *const *states,
+                                                      const gchar *const *patterns,
+                                                      GVariant **unit_files,
+                                                      GError **error);
+
+/*
+ * Queue a start job for the unit `name`, `job` being set to the path of the
+ * job if not NULL. Its end is signalled by the Manager's JobRemoved signal.
+ */
+gboolean systemd1_manager_start_unit(GDBusConnection *conn,
+                                     const gchar *bus_name,
+                                     const gchar *name,
+                                     const gchar *mode,
+                                     gchar **job,
+                                     GError **error);
+
+gboolean systemd1_manager_subscribe(GDBusConnection *conn,
+                                    const gchar *bus_name,
+                                    GError **error);
+
+/*
+ * Subscribe to a signal of the Manager interface, returns the subscription
+ * ID for g_dbus_connection_signal_unsubscribe().
+ */
+guint systemd1_manager_signal_subscribe(GDBusConnection *conn,
+                                        const gchar *bus_name,
+                                        const gchar *member,
+                                        GDBusSignalCallback callback,
+                                        gpointer user_data);
+
+/*
+ * Get a property of a systemd object, checking it is of the given type.
+ */
+GVariant *systemd1_get_property(GDBusConnection *conn,
+                                const gchar *bus_name,
+                                const gchar *object_path,
+                                const gchar *interface_name,
+                                const gchar *property_name,
+                                const GVariantType *type,
+                                GError **error);
+
+/*
+ * A unit whose state is followed through its PropertiesChanged signal.
+ */
+typedef struct _Systemd1Unit Systemd1Unit;
+
+/*
+ * Called when the ActiveState of the unit changed, which is parsed as it is
+ * received. The unit may be freed from the callback.
+ */
+typedef void (*Systemd1UnitChangedFunc)(Systemd1Unit *unit, gpointer user_data);
+
+Systemd1Unit *systemd1_unit_new(GDBusConnection *conn,
+                                const gchar *bus_name,
+                                const gchar *object_path,
+                                Systemd1UnitChangedFunc callback,
+                                gpointer user_data,
+                                GError **error);
+
+void systemd1_unit_free(Systemd1Unit *unit);
+
+UnitState systemd1_unit_get_active_state(Systemd1Unit *unit);
+
+/*
+ * CLOCK_MONOTONIC timestamps of the last state changes, 0 until received
+ * along with an ActiveState change.
+ */
+guint64 systemd1_unit_get_inactive_exit_timestamp_monotonic(Systemd1Unit *unit);
+
+guint64 systemd1_unit_get_active_enter_timestamp_monotonic(Systemd1Unit *unit);
+
+G_END_DECLS
+
+#endif
@@ -4,7 +4,14 @@
  */
 
 #include <stdbool.h>
+#include <unistd.h>
 #include "systemd_manager.h"
+#include "app_state.h"
+#include "launch_trace.h"
+#include "metrics.h"
+#include "probes.h"
+#include "startup_profile.h"
+#include "systemd1_client.h"
 #include "utils.h"
 
 // Pull in for sd_bus_path_encode, as there's no obvious alternative
@@ -12,20 +19,71 @@
 // be used!
 #include <systemd/sd-bus.h>
 
-// gdbus generated headers
-#include "systemd1_manager_interface.h"
-#include "systemd1_unit_interface.h"
-
 extern GMainLoop *main_loop;
 
+// Format of the saved state, see systemd_manager_save_state()
+#define SYSTEMD_MANAGER_STATE_TYPE "(ta(ssssuuuubxs))"
+
+// systemd's peer-to-peer socket, only root may connect to it
+#define SYSTEMD_PRIVATE_ADDRESS "unix:path=/run/systemd/private"
+
+// See systemd_manager_set_use_private_socket()
+static gboolean use_private_socket;
+
+/*
+ * systemd D-Bus calls whose duration is measured
+ */
+typedef enum {
+    SYSTEMD_CALL_LIST_UNIT_FILES,
+    SYSTEMD_CALL_GET_PROPERTY,
+    SYSTEMD_CALL_START_UNIT,
+    SYSTEMD_CALL_SUBSCRIBE,
+    SYSTEMD_CALL_COUNT
+} SystemdCall;
+
+static const gchar *systemd_call_labels[SYSTEMD_CALL_COUNT] = {
+    [SYSTEMD_CALL_LIST_UNIT_FILES] = "method=\"ListUnitFilesByPatterns\"",
+    [SYSTEMD_CALL_GET_PROPERTY] = "method=\"Get\"",
+    [SYSTEMD_CALL_START_UNIT] = "method=\"StartUnit\"",
+    [SYSTEMD_CALL_SUBSCRIBE] = "method=\"Subscribe\"",
+};
+
 // Object data
 struct _SystemdManager {
     GObject parent_instance;
 
+    /*
+     * The manager is confined to the main context it was created in, other
+     * threads post commands to it using systemd_manager_invoke().
+     */
+    GMainContext *context;
+
     GDBusConnection *conn;
-    Systemd1Manager *proxy;
+    // systemd's name on the bus, NULL when connected to its private socket
+    const gchar *bus_name;
+    guint unit_files_changed_id;
+    guint reloading_id;
+    guint job_removed_id;
 
     GList *apps_list;
+    guint64 catalog_version;
+
+    /*
+     * Status notifications following another one within `coalesce_window`
+     * ms are held back per application, so that bursts of transitions
+     * only deliver their first and net changes, 0 delivers every
+     * transition immediately.
+     */
+    guint coalesce_window;
+    GHashTable *pending_status;
+    guint64 suppressed_events;
+
+    /* Metrics, see metrics.h */
+    Metric *call_duration[SYSTEMD_CALL_COUNT];
+    Metric *start_duration;
+    Metric *starts;
+    Metric *failures;
+    Metric *coalesced;
 };
 
 G_DEFINE_TYPE(SystemdManager, systemd_manager, G_TYPE_OBJECT);
@@ -33,6 +91,8 @@ G_DEFINE_TYPE(SystemdManager, systemd_manager, G_TYPE_OBJECT);
 enum {
   STARTED,
   TERMINATED,
+  STATUS_CHANGED,
+  CATALOG_CHANGED,
   N_SIGNALS
 };
 static guint signals[N_SIGNALS];
@@ -44,13 +104,66 @@ static guint signals[N_SIGNALS];
 struct systemd_runtime_data {
     gchar *esc_service;
     SystemdManager *mgr;
-    Systemd1Unit *proxy;
+    Systemd1Unit *unit;
+    // Time at which the unit was last asked to start, 0 once running
+    gint64 start_time;
+    // Time at which the last start job was queued, 0 once the unit acted on it
+    gint64 start_job_time;
+    // Path of that start job until systemd removes it, NULL if none
+    gchar *start_job;
+};
+
+/*
+ * Status notification held back during the coalescing window
+ */
+struct pending_status {
+    SystemdManager *mgr;
+    AppInfo *app_info;
+    AppStatus delivered;
+    AppFailureReason delivered_reason;
+    guint events;
+    // End of the coalescing window, attached to the manager's context
+    GSource *source;
 };
 
 /*
  * Internal functions
  */
 
+static void systemd_manager_record_call(SystemdManager *self,
+                                        SystemdCall call,
+                                        gint64 start)
+{
+    metric_record(self->call_duration[call], g_get_monotonic_time() - start);
+}
+
+static struct pending_status *pending_status_new(SystemdManager *mgr,
+                                                 AppInfo *app_info,
+                                                 AppStatus delivered,
+                                                 AppFailureReason delivered_reason)
+{
+    struct pending_status *pending = g_new0(struct pending_status, 1);
+
+    pending->mgr = mgr;
+    pending->app_info = app_info;
+    pending->delivered = delivered;
+    pending->delivered_reason = delivered_reason;
+    g_hash_table_insert(mgr->pending_status, app_info, pending);
+
+    return pending;
+}
+
+static void pending_status_free(gpointer data)
+{
+    struct pending_status *pending = data;
+
+    if (pending->source) {
+        g_source_destroy(pending->source);
+        g_source_unref(pending->source);
+    }
+    g_free(pending);
+}
+
 /*
  * Get app unit list
  */
@@ -64,12 +177,15 @@ static gboolean systemd_manager_enumerate_app_units(SystemdManager *self,
     GError *error = NULL;
     const gchar *const states[1] = { NULL }; 
     const gchar *const patterns[2] = { "agl-app*@*.service", NULL }; 
-    if (!systemd1_manager_call_list_unit_files_by_patterns_sync(self->proxy,
-								states,
-								patterns,
-								&matched_units,
-								NULL,
-								&error)) {
+    gint64 start = g_get_monotonic_time();
+    gboolean ret = systemd1_manager_list_unit_files_by_patterns(self->conn,
+                                                                self->bus_name,
+                                                                states,
+                                                                patterns,
+                                                                &matched_units,
+                                                                &error);
+    systemd_manager_record_call(self, SYSTEMD_CALL_LIST_UNIT_FILES, start);
+    if (!ret) {
         g_critical("Failed to issue method call: %s", error ? error->message : "unspecified");
 	g_error_free(error);
         goto finish;
@@ -111,25 +227,25 @@ static gboolean systemd_manager_get_app_description(SystemdManager *self,
     sd_bus_path_encode("/org/freedesktop/systemd1/unit", service, &esc_service);
 
     GError *error = NULL;
-    Systemd1Unit *proxy = systemd1_unit_proxy_new_sync(self->conn,
-						       G_DBUS_PROXY_FLAGS_NONE,
-						       "org.freedesktop.systemd1",
-						       esc_service,
-						       NULL,
-						       &error);
-    if (!proxy) {
-        g_critical("Failed to create org.freedesktop.systemd1.Unit proxy: %s",
+    gint64 start = g_get_monotonic_time();
+    GVariant *value = systemd1_get_property(self->conn,
+                                            self->bus_name,
+                                            esc_service,
+                                            "org.freedesktop.systemd1.Unit",
+                                            "Description",
+                                            G_VARIANT_TYPE_STRING,
+                                            &error);
+    systemd_manager_record_call(self, SYSTEMD_CALL_GET_PROPERTY, start);
+    g_free(esc_service);
+    if (!value) {
+        g_critical("Failed to get Description of %s: %s", service,
 		   error ? error->message : "unspecified");
 	g_error_free(error);
 	goto finish;
     }
 
-    gchar *value = systemd1_unit_dup_description(proxy);
-    if (value) {
-	*description = value;
-    }
-
-    g_object_unref(proxy);
+    *description = g_variant_dup_string(value, NULL);
+    g_variant_unref(value);
     return TRUE;
 
 finish:
@@ -139,13 +255,64 @@ finish:
 }
 
 /*
- * This function is executed during the object initialization. It goes through
- * all available applications on the system and creates a static list
- * containing all the relevant info (ID, name, unit, icon...) for further
- * processing.
+ * Parse the application ID out of an agl-app*@<app-id>.service unit name,
+ * returns NULL if there is none.
+ */
+static gchar *app_id_from_service(const gchar *service)
+{
+    g_autofree char *tmp = g_strdup(service);
+    char *end = tmp + strlen(tmp);
+    while (end > tmp && *end != '.') {
+        --end;
+    }
+    if (end > tmp) {
+        *end = '\0';
+    } else {
+        return NULL;
+    }
+    while (end > tmp && *end != '@') {
+        --end;
+    }
+    if (end > tmp) {
+        return g_strdup(end + 1);
+    }
+    // Potentially handle non-template agl-app-foo.service units here
+
+    return NULL;
+}
+
+static AppInfo *find_app_info(GList *apps_list, const gchar *app_id)
+{
+    for (GList *l = apps_list; l != NULL; l = l->next) {
+        AppInfo *app_info = l->data;
+
+        if (g_strcmp0(app_info_get_app_id(app_info), app_id) == 0)
+            return app_info;
+    }
+
+    return NULL;
+}
+
+/*
+ * Stop tracking an application which is no longer available.
+ */
+static void systemd_manager_forget_app(SystemdManager *self, AppInfo *app_info)
+{
+    g_hash_table_remove(self->pending_status, app_info);
+    app_info_set_runtime_data(app_info, NULL, NULL);
+}
+
+/*
+ * This function is executed during the object initialization and whenever
+ * systemd's unit files change. It goes through all available applications
+ * on the system and (re)builds the list containing all the relevant info
+ * (ID, name, unit, icon...) for further processing. Applications which were
+ * already known keep their AppInfo, and thus their status.
  */
 static void systemd_manager_update_applications_list(SystemdManager *self)
 {
+    gboolean changed = FALSE;
+
     g_auto(GStrv) dirlist = NULL;
 
     char *xdg_data_dirs = getenv("XDG_DATA_DIRS");
@@ -153,10 +320,17 @@ static void systemd_manager_update_applications_list(SystemdManager *self)
         dirlist = g_strsplit(getenv("XDG_DATA_DIRS"), ":", -1);
 
     GList *units = NULL;
-    if (!systemd_manager_enumerate_app_units(self, &units)) {
+    APPLAUNCHD_PROBE0(catalog__enumerate__begin);
+    gint64 start = g_get_monotonic_time();
+    gboolean enumerated = systemd_manager_enumerate_app_units(self, &units);
+    startup_profile_add(STARTUP_PHASE_UNIT_ENUMERATION, start);
+    if (!enumerated) {
         return;
     }
+    if (APPLAUNCHD_PROBE_ENABLED(catalog__enumerate__end))
+        APPLAUNCHD_PROBE1(catalog__enumerate__end, g_list_length(units));
 
+    GList *apps = NULL;
     GList *iterator;
     for (iterator = units; iterator != NULL; iterator = iterator->next) {
         g_autofree const gchar *app_id = NULL;
@@ -174,31 +348,21 @@ static void systemd_manager_update_applications_list(SystemdManager *self)
         else
             service = p + 1;
 
-        g_autofree char *tmp = g_strdup(service);
-        char *end = tmp + strlen(tmp);
-        while (end > tmp && *end != '.') {
-            --end;
-        }
-        if (end > tmp) {
-            *end = '\0';
-        } else {
-            g_free(tmp);
+        app_id = app_id_from_service(service);
+        if (!app_id)
+            continue;
+
+        if (find_app_info(apps, app_id)) {
+            g_warning("Ignoring duplicate application '%s'", app_id);
             continue;
         }
-        while (end > tmp && *end != '@') {
-            --end;
-        }
-        if (end > tmp) {
-            app_id = g_strdup(end + 1);
-        }
-        // Potentially handle non-template agl-app-foo.service units here
 
         // Try getting display name from unit Description property
         g_autofree gchar *name = NULL;
-        if (!systemd_manager_get_app_description(self,
-                                                 service,
-                                                 &name) ||
-            name == NULL) {
+        start = g_get_monotonic_time();
+        gboolean described = systemd_manager_get_app_description(self, service, &name);
+        startup_profile_add(STARTUP_PHASE_UNIT_DESCRIPTIONS, start);
+        if (!described || name == NULL) {
 
             // Fall back to the application ID
             g_warning("Could not retrieve Description of '%s'", service);
@@ -209,18 +373,111 @@ static void systemd_manager_update_applications_list(SystemdManager *self)
          * GAppInfo retrieves the icon data but doesn't provide a way to retrieve
          * the corresponding file name, so we have to look it up by ourselves.
          */
-        if (app_id && dirlist)
+        if (app_id && dirlist) {
+            start = g_get_monotonic_time();
             icon_path = applaunchd_utils_get_icon(dirlist, app_id);
+            startup_profile_add(STARTUP_PHASE_ICON_SEARCH, start);
+        }
 
-        app_info = app_info_new(app_id,
-				name,
-				icon_path ? icon_path : "",
-				service);
+        app_info = find_app_info(self->apps_list, app_id);
+        if (app_info) {
+            if (app_info_update(app_info, name, icon_path ? icon_path : "", service)) {
+                g_debug("Updating application '%s' with display name '%s'", app_id, name);
+                changed = TRUE;
+            }
+            g_object_ref(app_info);
+        } else {
+            app_info = app_info_new(app_id,
+                                    name,
+                                    icon_path ? icon_path : "",
+                                    service);
+            g_debug("Adding application '%s' with display name '%s'", app_id, name);
+            changed = TRUE;
+        }
 
-        g_debug("Adding application '%s' with display name '%s'", app_id, name);
-        self->apps_list = g_list_append(self->apps_list, app_info);
+        apps = g_list_prepend(apps, app_info);
     }
     g_list_free_full(units, g_free);
+
+    apps = g_list_reverse(apps);
+    for (GList *l = self->apps_list; l != NULL; l = l->next) {
+        AppInfo *app_info = l->data;
+
+        if (!find_app_info(apps, app_info_get_app_id(app_info))) {
+            g_debug("Removing application '%s'", app_info_get_app_id(app_info));
+            systemd_manager_forget_app(self, app_info);
+            changed = TRUE;
+        }
+    }
+    g_list_free_full(self->apps_list, g_object_unref);
+    self->apps_list = apps;
+
+    if (APPLAUNCHD_PROBE_ENABLED(catalog__build__end))
+        APPLAUNCHD_PROBE2(catalog__build__end, g_list_length(apps), changed);
+
+    if (changed || self->catalog_version == 0) {
+        /*
+         * Versions start from a random epoch rather than 1, so that one
+         * known from a previous instance, which may have listed other
+         * applications, doesn't match by chance.
+         */
+        if (self->catalog_version == 0)
+            self->catalog_version = (guint64)g_random_int() << 32;
+        self->catalog_version++;
+        g_signal_emit(self, signals[CATALOG_CHANGED], 0);
+    }
+}
+
+/*
+ * Refresh the applications list when unit files get installed or removed,
+ * or once systemd is done reloading its configuration.
+ */
+static void unit_files_changed_cb(GDBusConnection *conn,
+                                  const gchar *sender_name,
+                                  const gchar *object_path,
+                                  const gchar *interface_name,
+                                  const gchar *signal_name,
+                                  GVariant *parameters,
+                                  gpointer user_data)
+{
+    SystemdManager *self = user_data;
+
+    g_debug("Unit files changed, refreshing applications list");
+    systemd_manager_update_applications_list(self);
+}
+
+static void reloading_cb(GDBusConnection *conn,
+                         const gchar *sender_name,
+                         const gchar *object_path,
+                         const gchar *interface_name,
+                         const gchar *signal_name,
+                         GVariant *parameters,
+                         gpointer user_data)
+{
+    if (!g_variant_is_of_type(parameters, G_VARIANT_TYPE("(b)")))
+        return;
+
+    GVariant *active = g_variant_get_child_value(parameters, 0);
+    if (!g_variant_get_boolean(active))
+        unit_files_changed_cb(conn, sender_name, object_path, interface_name,
+                              signal_name, parameters, user_data);
+    g_variant_unref(active);
+}
+
+/*
+ * Stop receiving the Manager signals, before dropping the connection.
+ */
+static void systemd_manager_unsubscribe(SystemdManager *self)
+{
+    if (self->unit_files_changed_id)
+        g_dbus_connection_signal_unsubscribe(self->conn, self->unit_files_changed_id);
+    if (self->reloading_id)
+        g_dbus_connection_signal_unsubscribe(self->conn, self->reloading_id);
+    if (self->job_removed_id)
+        g_dbus_connection_signal_unsubscribe(self->conn, self->job_removed_id);
+    self->unit_files_changed_id = 0;
+    self->reloading_id = 0;
+    self->job_removed_id = 0;
 }
 
 
@@ -234,11 +491,18 @@ static void systemd_manager_dispose(GObject *object)
 
     g_return_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self));
 
+    g_clear_pointer(&self->pending_status, g_hash_table_unref);
+
     if (self->apps_list)
         g_list_free_full(g_steal_pointer(&self->apps_list), g_object_unref);
 
-    g_object_unref(self->proxy);
-    g_object_unref(self->conn);
+    if (self->conn) {
+        systemd_manager_unsubscribe(self);
+        g_signal_handlers_disconnect_by_data(self->conn, self);
+    }
+    g_clear_object(&self->conn);
+
+    g_clear_pointer(&self->context, g_main_context_unref);
 
     G_OBJECT_CLASS(systemd_manager_parent_class)->dispose(object);
 }
@@ -264,49 +528,273 @@ static void systemd_manager_class_init(SystemdManagerClass *klass)
                                        G_SIGNAL_RUN_LAST, 0 ,
                                        NULL, NULL, NULL, G_TYPE_NONE,
                                        1, G_TYPE_STRING);
+
+    signals[STATUS_CHANGED] = g_signal_new("status-changed", G_TYPE_FROM_CLASS (klass),
+                                           G_SIGNAL_RUN_LAST, 0 ,
+                                           NULL, NULL, NULL, G_TYPE_NONE,
+                                           4, G_TYPE_STRING, G_TYPE_INT, G_TYPE_INT,
+                                           G_TYPE_INT);
+
+    signals[CATALOG_CHANGED] = g_signal_new("catalog-changed", G_TYPE_FROM_CLASS (klass),
+                                            G_SIGNAL_RUN_LAST, 0 ,
+                                            NULL, NULL, NULL, G_TYPE_NONE,
+                                            0);
 }
 
 static void systemd_manager_init(SystemdManager *self)
+{
+    self->context = g_main_context_ref_thread_default();
+
+    self->start_duration = metrics_histogram("applaunchd_app_start_duration_microseconds", NULL,
+                                             "Time from start request to running application");
+    self->starts = metrics_counter("applaunchd_app_starts", NULL,
+                                   "Application start requests sent to systemd");
+    self->failures = metrics_counter("applaunchd_app_failures", NULL,
+                                     "Applications which failed");
+    self->coalesced = metrics_counter("applaunchd_status_events_coalesced", NULL,
+                                      "Status changes superseded within the coalescing window");
+    self->pending_status = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                                 NULL, pending_status_free);
+}
+
+
+/*
+ * Internal callbacks
+ */
+
+/*
+ * Query the "Result" property of a failed service in order to report
+ * why it failed.
+ */
+static AppFailureReason systemd_manager_get_failure_reason(SystemdManager *self,
+                                                           const gchar *esc_service)
 {
     GError *error = NULL;
-    GDBusConnection *conn = g_bus_get_sync(G_BUS_TYPE_SYSTEM, NULL, &error);
-    if (!conn) {
-        g_critical("Failed to connect to D-Bus: %s", error ? error->message : "unspecified");
-	g_error_free(error);
-	return;
+    gint64 start = g_get_monotonic_time();
+    GVariant *value = systemd1_get_property(self->conn,
+                                            self->bus_name,
+                                            esc_service,
+                                            "org.freedesktop.systemd1.Service",
+                                            "Result",
+                                            G_VARIANT_TYPE_STRING,
+                                            &error);
+    systemd_manager_record_call(self, SYSTEMD_CALL_GET_PROPERTY, start);
+    if (!value) {
+        g_warning("Failed to get Result of %s: %s", esc_service,
+                  error ? error->message : "unspecified");
+        g_error_free(error);
+        return APP_FAILURE_UNKNOWN;
     }
-    self->conn = conn;
 
-    Systemd1Manager *proxy = systemd1_manager_proxy_new_sync(conn,
-							     G_DBUS_PROXY_FLAGS_NONE,
-							     "org.freedesktop.systemd1",
-							     "/org/freedesktop/systemd1",
-							     NULL,
-							     &error);
-    if (!proxy) {
-        g_critical("Failed to create org.freedesktop.systemd1.Manager proxy: %s",
-		   error ? error->message : "unspecified");
-	g_error_free(error);
-	return;
+    AppFailureReason reason = app_failure_reason_from_result(g_variant_get_string(value, NULL));
+    g_variant_unref(value);
+
+    return reason;
+}
+
+/*
+ * Notify listeners about the current status of an application, `previous`
+ * being the last status they were notified about.
+ */
+static void systemd_manager_notify_status(SystemdManager *self,
+                                          AppInfo *app_info,
+                                          AppStatus previous)
+{
+    const gchar *app_id = app_info_get_app_id(app_info);
+    AppStatus status = app_info_get_status(app_info);
+    AppNotify notify = app_state_notification(previous, status);
+
+    g_signal_emit(self, signals[STATUS_CHANGED], 0, app_id, status,
+                  app_info_get_failure_reason(app_info), notify);
+
+    switch (notify) {
+    case APP_NOTIFY_STARTED:
+        g_signal_emit(self, signals[STARTED], 0, app_id);
+        break;
+    case APP_NOTIFY_TERMINATED:
+        g_signal_emit(self, signals[TERMINATED], 0, app_id);
+        break;
+    default:
+        break;
     }
-    self->proxy = proxy;
+}
 
-    systemd_manager_update_applications_list(self);
+/*
+ * Deliver the net change of the `events` status changes which followed the
+ * last delivered one, or drop them if the application is back to it.
+ */
+static void systemd_manager_deliver_net_status(SystemdManager *self,
+                                               AppInfo *app_info,
+                                               AppStatus delivered,
+                                               AppFailureReason delivered_reason,
+                                               guint events)
+{
+    if (events == 0)
+        return;
+
+    if (app_info_get_status(app_info) == delivered &&
+        app_info_get_failure_reason(app_info) == delivered_reason) {
+        g_debug("Application %s is back to %s, dropping %u events",
+                app_info_get_app_id(app_info), app_status_to_string(delivered), events);
+        self->suppressed_events += events;
+        metric_add(self->coalesced, events);
+    } else {
+        self->suppressed_events += events - 1;
+        metric_add(self->coalesced, events - 1);
+        systemd_manager_notify_status(self, app_info, delivered);
+    }
 }
 
+/*
+ * End of a coalescing window: deliver the net status change, if any, and
+ * hold back the following ones for another window. A window without any
+ * status change closes.
+ */
+static gboolean systemd_manager_window_cb(gpointer user_data)
+{
+    struct pending_status *pending = user_data;
+    SystemdManager *self = pending->mgr;
+    AppInfo *app_info = pending->app_info;
+    AppStatus delivered = pending->delivered;
+    AppFailureReason delivered_reason = pending->delivered_reason;
+    guint events = pending->events;
+
+    if (events == 0) {
+        g_hash_table_remove(self->pending_status, app_info);
+        return G_SOURCE_REMOVE;
+    }
+
+    // Listeners may flush the application, don't touch `pending` past this
+    pending->delivered = app_info_get_status(app_info);
+    pending->delivered_reason = app_info_get_failure_reason(app_info);
+    pending->events = 0;
+    systemd_manager_deliver_net_status(self, app_info, delivered, delivered_reason, events);
+
+    return G_SOURCE_CONTINUE;
+}
 
 /*
- * Internal callbacks
+ * Deliver any status change still held back for the given application,
+ * closing its coalescing window.
+ */
+static void systemd_manager_flush_status(SystemdManager *self,
+                                         AppInfo *app_info)
+{
+    struct pending_status *pending = g_hash_table_lookup(self->pending_status, app_info);
+
+    if (pending) {
+        AppStatus delivered = pending->delivered;
+        AppFailureReason delivered_reason = pending->delivered_reason;
+        guint events = pending->events;
+
+        g_hash_table_remove(self->pending_status, app_info);
+        systemd_manager_deliver_net_status(self, app_info, delivered, delivered_reason, events);
+    }
+}
+
+/*
+ * Apply a new application status and notify listeners about it. Only the
+ * first change is notified right away, the ones following it within the
+ * coalescing window are held back until the window is over.
+ */
+static void systemd_manager_set_app_status(SystemdManager *self,
+                                           AppInfo *app_info,
+                                           AppStatus status,
+                                           AppFailureReason reason)
+{
+    AppStatus previous = app_info_get_status(app_info);
+
+    g_debug("Application %s is now %s", app_info_get_app_id(app_info),
+            app_status_to_string(status));
+    app_info_set_status(app_info, status);
+    app_info_set_failure_reason(app_info, reason);
+
+    if (status == APP_STATUS_INACTIVE || status == APP_STATUS_FAILED)
+        launch_trace_fail(app_info_get_app_id(app_info));
+
+    struct pending_status *pending = g_hash_table_lookup(self->pending_status, app_info);
+    if (pending) {
+        pending->events++;
+        return;
+    }
+
+    // Opened first so that changes made by listeners get held back too
+    if (self->coalesce_window > 0) {
+        pending = pending_status_new(self, app_info, status, reason);
+        pending->source = g_timeout_source_new(self->coalesce_window);
+        g_source_set_callback(pending->source, systemd_manager_window_cb, pending, NULL);
+        g_source_set_name(pending->source, "[applaunchd] status coalescing window");
+        g_source_attach(pending->source, self->context);
+    }
+    systemd_manager_notify_status(self, app_info, previous);
+}
+
+/*
+ * Update the status of a tracked application according to the ActiveState
+ * of its unit.
  */
+static void systemd_manager_update_unit_state(AppInfo *app_info,
+                                              struct systemd_runtime_data *data,
+                                              UnitState unit_state)
+{
+    AppStatus status = app_info_get_status(app_info);
+
+    /*
+     * The unit acted on the start job once seen leaving "inactive", or if
+     * it went through its whole life in between two signals, once its
+     * InactiveExitTimestamp moved past the time the job was queued.
+     */
+    if (data->start_job_time &&
+        ((unit_state != UNIT_STATE_INACTIVE && unit_state != UNIT_STATE_DEACTIVATING &&
+          unit_state != UNIT_STATE_UNKNOWN) ||
+         systemd1_unit_get_inactive_exit_timestamp_monotonic(data->unit) >=
+             (guint64)data->start_job_time))
+        data->start_job_time = 0;
+
+    AppStatus next = app_state_transition(status, unit_state, data->start_job_time != 0);
+
+    APPLAUNCHD_PROBE4(unit__transition, app_info_get_app_id(app_info), unit_state,
+                      status, next);
+
+    // PropertiesChanged signal gets triggered multiple times, only handle actual changes
+    if (next == status)
+        return;
+
+    AppFailureReason reason = APP_FAILURE_NONE;
+    if (next == APP_STATUS_FAILED) {
+        reason = systemd_manager_get_failure_reason(data->mgr, data->esc_service);
+        metric_inc(data->mgr->failures);
+    }
+
+    if (next == APP_STATUS_RUNNING) {
+        const gchar *app_id = app_info_get_app_id(app_info);
+        gint64 now = g_get_monotonic_time();
+
+        // Split the launch between systemd and the application itself
+        launch_trace_mark(app_id, LAUNCH_STAGE_INACTIVE_EXIT,
+                          systemd1_unit_get_inactive_exit_timestamp_monotonic(data->unit));
+        launch_trace_mark(app_id, LAUNCH_STAGE_ACTIVE_ENTER,
+                          systemd1_unit_get_active_enter_timestamp_monotonic(data->unit));
+        launch_trace_mark(app_id, LAUNCH_STAGE_RUNNING, now);
+
+        if (data->start_time) {
+            metric_record(data->mgr->start_duration, now - data->start_time);
+            data->start_time = 0;
+        }
+    }
+
+    systemd_manager_set_app_status(data->mgr, app_info, next, reason);
+
+    // The unit is done, stop tracking it
+    if (next == APP_STATUS_INACTIVE || next == APP_STATUS_FAILED)
+        app_info_set_runtime_data(app_info, NULL, NULL);
+}
 
 /*
- * This function is called when "PropertiesChanged" signal happens for
- * the matched Unit - check its "ActiveState" to update the app status
+ * This function is called when the "ActiveState" of the matched Unit
+ * changed, to update the app status
  */
-static void unit_properties_changed_cb(GDBusProxy *proxy,
-				       GVariant *changed_properties,
-				       const gchar* const *invalidated_properties,
-				       gpointer user_data)
+static void unit_state_changed_cb(Systemd1Unit *unit, gpointer user_data)
 {
     AppInfo *app_info = user_data;
     struct systemd_runtime_data *data;
@@ -317,53 +805,347 @@ static void unit_properties_changed_cb(GDBusProxy *proxy,
         return;
     }
 
-    // NOTE: changed_properties and invalidated_properties are guaranteed to never be NULL
-    gchar *new_state = NULL;
-    bool found = false;
-    if (g_variant_n_children(changed_properties) > 0) {
-	GVariantIter *iter;
-	const gchar *key;
-	GVariant *value;
-
-	g_variant_get(changed_properties, "a{sv}", &iter);
-	while (g_variant_iter_loop (iter, "{&sv}", &key, &value)) {
-	    if (!g_strcmp0(key, "ActiveState")) {
-		    new_state = g_variant_dup_string(value, NULL);
-		    found = true;
-	    }
-	}
-	g_variant_iter_free(iter);
-    }
-
-    // Ignore invalidated_properties for now
-
-    // Return if the changed property isn't "ActiveState"
-    if (!found)
-	return;
-
-    if(!g_strcmp0(new_state, "inactive"))
-    {
-        if(app_info_get_status(app_info) != APP_STATUS_STARTING)
-        {
-	    g_debug("Application %s has terminated", app_info_get_app_id(app_info));
-            app_info_set_status(app_info, APP_STATUS_INACTIVE);
-            app_info_set_runtime_data(app_info, NULL);
-
-            g_signal_emit(data->mgr, signals[TERMINATED], 0, app_info_get_app_id(app_info));
-            systemd_manager_free_runtime_data(data);
-	}
-    }
-    else if(!g_strcmp0(new_state, "active"))
-    {
-        // PropertiesChanged signal gets triggered multiple times, only handle it once
-        if(app_info_get_status(app_info) != APP_STATUS_RUNNING)
-        {
-            g_debug("Application %s has started", app_info_get_app_id(app_info));
-            app_info_set_status(app_info, APP_STATUS_RUNNING);
-            g_signal_emit(data->mgr, signals[STARTED], 0, app_info_get_app_id(app_info));
+    systemd_manager_update_unit_state(app_info, data, systemd1_unit_get_active_state(unit));
+}
+
+/*
+ * This function is called when systemd is done with a job. Once the start
+ * job of an application is gone, its unit won't leave "inactive" on its
+ * own anymore, e.g. as one of its conditions was not met or one of its
+ * dependencies failed, so the status must stop waiting for it to start.
+ */
+static void job_removed_cb(GDBusConnection *conn,
+                           const gchar *sender_name,
+                           const gchar *object_path,
+                           const gchar *interface_name,
+                           const gchar *signal_name,
+                           GVariant *parameters,
+                           gpointer user_data)
+{
+    SystemdManager *self = user_data;
+    const gchar *job, *unit, *result;
+
+    if (!g_variant_is_of_type(parameters, G_VARIANT_TYPE("(uoss)")))
+        return;
+
+    g_variant_get(parameters, "(u&o&s&s)", NULL, &job, &unit, &result);
+
+    for (GList *l = self->apps_list; l != NULL; l = l->next) {
+        AppInfo *app_info = l->data;
+        struct systemd_runtime_data *data = app_info_get_runtime_data(app_info);
+
+        if (!data || g_strcmp0(data->start_job, job) != 0)
+            continue;
+
+        g_debug("Start job of %s removed with result '%s'", unit, result);
+        g_clear_pointer(&data->start_job, g_free);
+        data->start_job_time = 0;
+
+        AppFailureReason reason = app_failure_reason_from_job_result(result);
+        if (reason != APP_FAILURE_NONE &&
+            app_info_get_status(app_info) == APP_STATUS_STARTING) {
+            metric_inc(self->failures);
+            systemd_manager_set_app_status(self, app_info, APP_STATUS_FAILED, reason);
+            app_info_set_runtime_data(app_info, NULL, NULL);
+        } else {
+            systemd_manager_update_unit_state(app_info, data,
+                                              systemd1_unit_get_active_state(data->unit));
+        }
+        break;
+    }
+}
+
+/*
+ * Start following the unit state changes of an application, returns its
+ * runtime data or NULL on failure.
+ */
+static struct systemd_runtime_data *systemd_manager_track_app(SystemdManager *self,
+                                                              AppInfo *app_info)
+{
+    const gchar *service = app_info_get_service(app_info);
+    struct systemd_runtime_data *runtime_data = g_new0(struct systemd_runtime_data, 1);
+
+    // Get the escaped unit name in the systemd hierarchy
+    sd_bus_path_encode("/org/freedesktop/systemd1/unit", service, &runtime_data->esc_service);
+    runtime_data->mgr = self;
+
+    GError *error = NULL;
+    gint64 start = g_get_monotonic_time();
+    Systemd1Unit *unit = systemd1_unit_new(self->conn,
+                                           self->bus_name,
+                                           runtime_data->esc_service,
+                                           unit_state_changed_cb,
+                                           app_info,
+                                           &error);
+    systemd_manager_record_call(self, SYSTEMD_CALL_GET_PROPERTY, start);
+    if (!unit) {
+        g_critical("Failed to follow the state of %s: %s", service,
+		   error ? error->message : "unspecified");
+	g_error_free(error);
+        systemd_manager_free_runtime_data(runtime_data);
+        return NULL;
+    }
+    runtime_data->unit = unit;
+
+    app_info_set_runtime_data(app_info, runtime_data, systemd_manager_free_runtime_data);
+
+    return runtime_data;
+}
+
+/*
+ * Once a saved state was restored: apply the unit state changes which
+ * happened while no instance was running, so that listeners get notified
+ * about them, and check whether the applications list is still current.
+ */
+static gboolean systemd_manager_reconcile_cb(gpointer user_data)
+{
+    SystemdManager *self = user_data;
+
+    for (GList *l = self->apps_list; l != NULL; l = l->next) {
+        AppInfo *app_info = l->data;
+        struct systemd_runtime_data *data = app_info_get_runtime_data(app_info);
+
+        // Notify first the changes which were held back when saving
+        systemd_manager_flush_status(self, app_info);
+
+        AppStatus status = app_info_get_status(app_info);
+        if (data) {
+            systemd_manager_update_unit_state(app_info, data,
+                                              systemd1_unit_get_active_state(data->unit));
+        } else if (status != APP_STATUS_INACTIVE && status != APP_STATUS_FAILED) {
+            // We could not follow its unit again
+            systemd_manager_set_app_status(self, app_info, APP_STATUS_INACTIVE,
+                                           APP_FAILURE_NONE);
+        }
+    }
+
+    // Unit files may have come and gone in the meantime, only rebuild the
+    // applications list if so, as it means querying every unit. Units get
+    // mapped to applications as when building the list: the first unit of
+    // an application wins and the ones without an ID are skipped.
+    GList *units = NULL;
+    if (!systemd_manager_enumerate_app_units(self, &units))
+        return G_SOURCE_REMOVE;
+
+    GHashTable *services = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+    for (GList *l = units; l != NULL; l = l->next) {
+        gchar *service = g_path_get_basename(l->data);
+        gchar *app_id = app_id_from_service(service);
+
+        if (app_id && !g_hash_table_contains(services, app_id)) {
+            g_hash_table_insert(services, app_id, service);
+        } else {
+            g_free(app_id);
+            g_free(service);
+        }
+    }
+    g_list_free_full(units, g_free);
+
+    gboolean changed = g_hash_table_size(services) != g_list_length(self->apps_list);
+    for (GList *l = self->apps_list; l != NULL && !changed; l = l->next) {
+        const gchar *service = g_hash_table_lookup(services, app_info_get_app_id(l->data));
+
+        changed = g_strcmp0(service, app_info_get_service(l->data)) != 0;
+    }
+    g_hash_table_unref(services);
+
+    if (changed) {
+        g_debug("Unit files changed since the state was saved, refreshing applications list");
+        systemd_manager_update_applications_list(self);
+    }
+
+    return G_SOURCE_REMOVE;
+}
+
+/*
+ * Open a peer-to-peer connection to systemd, which spares the round trips
+ * through the D-Bus daemon.
+ */
+static GDBusConnection *systemd_manager_connect_private(void)
+{
+    if (geteuid() != 0) {
+        g_message("Not running as root, connecting to systemd through the system bus");
+        return NULL;
+    }
+
+    GError *error = NULL;
+    GDBusConnection *conn =
+        g_dbus_connection_new_for_address_sync(SYSTEMD_PRIVATE_ADDRESS,
+                                               G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT,
+                                               NULL, NULL, &error);
+    if (!conn) {
+        g_warning("Failed to connect to systemd's private socket, using the system bus: %s",
+                  error ? error->message : "unspecified");
+        g_error_free(error);
+    }
+
+    return conn;
+}
+
+static void connection_closed_cb(GDBusConnection *conn,
+                                 gboolean remote_peer_vanished,
+                                 GError *error,
+                                 gpointer user_data);
+
+/*
+ * Connect to systemd and subscribe to its signals.
+ */
+static gboolean systemd_manager_connect(SystemdManager *self)
+{
+    GError *error = NULL;
+    gint64 start = g_get_monotonic_time();
+    GDBusConnection *conn = use_private_socket ? systemd_manager_connect_private() : NULL;
+
+    self->bus_name = conn ? NULL : SYSTEMD1_BUS_NAME;
+    if (!conn)
+        conn = g_bus_get_sync(G_BUS_TYPE_SYSTEM, NULL, &error);
+    startup_profile_add(STARTUP_PHASE_BUS_CONNECT, start);
+
+    // Measured per transport, to compare both
+    const gchar *transport = self->bus_name ? "bus" : "private";
+    for (int i = 0; i < SYSTEMD_CALL_COUNT; i++) {
+        g_autofree gchar *labels = g_strdup_printf("%s,transport=\"%s\"",
+                                                   systemd_call_labels[i], transport);
+        self->call_duration[i] = metrics_histogram("applaunchd_systemd_call_duration_microseconds",
+                                                   labels,
+                                                   "Duration of systemd D-Bus calls");
+    }
+
+    if (!conn) {
+        g_critical("Failed to connect to D-Bus: %s", error ? error->message : "unspecified");
+	g_error_free(error);
+	return FALSE;
+    }
+    self->conn = conn;
+
+    if (!self->bus_name)
+        g_signal_connect(conn, "closed", G_CALLBACK(connection_closed_cb), self);
+
+    self->unit_files_changed_id =
+        systemd1_manager_signal_subscribe(conn, self->bus_name, "UnitFilesChanged",
+                                          unit_files_changed_cb, self);
+    self->reloading_id =
+        systemd1_manager_signal_subscribe(conn, self->bus_name, "Reloading",
+                                          reloading_cb, self);
+    self->job_removed_id =
+        systemd1_manager_signal_subscribe(conn, self->bus_name, "JobRemoved",
+                                          job_removed_cb, self);
+
+    // Make sure systemd sends out its signals, so we can refresh the list
+    start = g_get_monotonic_time();
+    gboolean subscribed = systemd1_manager_subscribe(conn, self->bus_name, &error);
+    systemd_manager_record_call(self, SYSTEMD_CALL_SUBSCRIBE, start);
+    startup_profile_add(STARTUP_PHASE_SUBSCRIBE, start);
+    if (!subscribed) {
+        g_warning("Failed to subscribe to systemd signals: %s",
+                  error ? error->message : "unspecified");
+        g_clear_error(&error);
+    }
+
+    return TRUE;
+}
+
+/*
+ * systemd drops its private connections when re-executing itself: connect
+ * again, follow the units of the tracked applications on the new connection
+ * and catch up with the changes we missed.
+ */
+static void connection_closed_cb(GDBusConnection *conn,
+                                 gboolean remote_peer_vanished,
+                                 GError *error,
+                                 gpointer user_data)
+{
+    SystemdManager *self = user_data;
+
+    g_warning("Connection to systemd closed, reconnecting");
+
+    g_signal_handlers_disconnect_by_data(conn, self);
+
+    // The units are followed on the closed connection
+    GList *tracked = NULL;
+    for (GList *l = self->apps_list; l != NULL; l = l->next) {
+        AppInfo *app_info = l->data;
+
+        if (app_info_get_runtime_data(app_info)) {
+            app_info_set_runtime_data(app_info, NULL, NULL);
+            tracked = g_list_prepend(tracked, app_info);
         }
     }
-    g_free(new_state);
+    systemd_manager_unsubscribe(self);
+    g_clear_object(&self->conn);
+
+    if (systemd_manager_connect(self)) {
+        for (GList *l = tracked; l != NULL; l = l->next)
+            systemd_manager_track_app(self, l->data);
+        systemd_manager_reconcile_cb(self);
+    }
+    g_list_free(tracked);
+}
+
+/*
+ * Rebuild the applications list from the state saved by a previous
+ * instance, see systemd_manager_save_state(). Only the units of the
+ * applications which were being tracked are queried, to follow them again.
+ * Statuses which were not notified yet are held back until reconciling.
+ */
+static gboolean systemd_manager_restore_state(SystemdManager *self, GVariant *state)
+{
+    if (!self->conn)
+        return FALSE;
+
+    if (!g_variant_is_of_type(state, G_VARIANT_TYPE(SYSTEMD_MANAGER_STATE_TYPE))) {
+        g_warning("Ignoring saved state of type %s", g_variant_get_type_string(state));
+        return FALSE;
+    }
+
+    gint64 start = g_get_monotonic_time();
+    guint64 catalog_version;
+    GVariantIter *iter;
+    g_variant_get(state, SYSTEMD_MANAGER_STATE_TYPE, &catalog_version, &iter);
+
+    const gchar *app_id, *name, *icon_path, *service, *start_job;
+    guint32 status, reason, delivered, delivered_reason;
+    gboolean tracked;
+    gint64 start_job_time;
+    GList *apps = NULL;
+    while (g_variant_iter_loop(iter, "(&s&s&s&suuuubx&s)", &app_id, &name, &icon_path, &service,
+                               &status, &reason, &delivered, &delivered_reason,
+                               &tracked, &start_job_time, &start_job)) {
+        if (status >= APP_STATUS_COUNT || reason > APP_FAILURE_UNKNOWN ||
+            delivered >= APP_STATUS_COUNT || delivered_reason > APP_FAILURE_UNKNOWN ||
+            find_app_info(apps, app_id))
+            continue;
+
+        AppInfo *app_info = app_info_new(app_id, name, icon_path, service);
+        app_info_set_status(app_info, status);
+        app_info_set_failure_reason(app_info, reason);
+        apps = g_list_prepend(apps, app_info);
+
+        if (delivered != status || delivered_reason != reason)
+            pending_status_new(self, app_info, delivered, delivered_reason)->events++;
+
+        if (tracked) {
+            struct systemd_runtime_data *data = systemd_manager_track_app(self, app_info);
+
+            if (data) {
+                data->start_job_time = start_job_time;
+                if (*start_job)
+                    data->start_job = g_strdup(start_job);
+            }
+        }
+    }
+    g_variant_iter_free(iter);
+
+    self->apps_list = g_list_reverse(apps);
+    self->catalog_version = catalog_version;
+
+    g_debug("Restored %u applications from the saved state", g_list_length(self->apps_list));
+    startup_profile_add(STARTUP_PHASE_STATE_RESTORE, start);
+
+    // Catch up once our listeners are connected
+    systemd_manager_invoke(self, systemd_manager_reconcile_cb, self, NULL);
+
+    return TRUE;
 }
 
 
@@ -372,9 +1154,24 @@ static void unit_properties_changed_cb(GDBusProxy *proxy,
  */
 
 SystemdManager *systemd_manager_get_default(void)
+{
+    return systemd_manager_get_default_with_state(NULL, NULL);
+}
+
+/*
+ * Same as systemd_manager_get_default(), creating the manager from the
+ * state saved by a previous instance if given, see
+ * systemd_manager_save_state(). `restored` is set to whether the state
+ * could be used, otherwise systemd is queried for all the applications.
+ */
+SystemdManager *systemd_manager_get_default_with_state(GVariant *state,
+                                                       gboolean *restored)
 {
     static SystemdManager *manager;
 
+    if (restored)
+        *restored = FALSE;
+
     /*
     * SystemdManager is a singleton, only create the object if it doesn't
     * exist already.
@@ -383,11 +1180,72 @@ SystemdManager *systemd_manager_get_default(void)
         g_debug("Initializing app launcher service...");
         manager = g_object_new(APPLAUNCHD_TYPE_SYSTEMD_MANAGER, NULL);
         g_object_add_weak_pointer(G_OBJECT(manager), (gpointer*) &manager);
+
+        systemd_manager_connect(manager);
+
+        if (state && systemd_manager_restore_state(manager, state)) {
+            if (restored)
+                *restored = TRUE;
+        } else if (manager->conn) {
+            systemd_manager_update_applications_list(manager);
+        }
     }
 
     return manager;
 }
 
+/*
+ * Connect to systemd through its private socket rather than the system bus
+ * when running as root, falling back to the bus otherwise. Must be called
+ * before the manager gets created.
+ */
+void systemd_manager_set_use_private_socket(gboolean use)
+{
+    use_private_socket = use;
+}
+
+/*
+ * Save the applications list and their status, for a later instance to
+ * restore it. Each application is saved with its status, the status last
+ * notified, which differs while held back by the coalescing window so the
+ * restored instance notifies about it, and whether its unit is followed
+ * along with the time its pending start job was queued and its path, empty
+ * if none.
+ */
+GVariant *systemd_manager_save_state(SystemdManager *self)
+{
+    g_return_val_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self), NULL);
+
+    GVariantBuilder apps;
+    g_variant_builder_init(&apps, G_VARIANT_TYPE("a(ssssuuuubxs)"));
+
+    for (GList *l = self->apps_list; l != NULL; l = l->next) {
+        AppInfo *app_info = l->data;
+        AppStatus status = app_info_get_status(app_info);
+        AppFailureReason reason = app_info_get_failure_reason(app_info);
+        AppStatus delivered = status;
+        AppFailureReason delivered_reason = reason;
+        struct pending_status *pending = g_hash_table_lookup(self->pending_status, app_info);
+        struct systemd_runtime_data *data = app_info_get_runtime_data(app_info);
+
+        if (pending) {
+            delivered = pending->delivered;
+            delivered_reason = pending->delivered_reason;
+        }
+
+        g_variant_builder_add(&apps, "(ssssuuuubxs)",
+                              app_info_get_app_id(app_info),
+                              app_info_get_name(app_info),
+                              app_info_get_icon_path(app_info),
+                              app_info_get_service(app_info),
+                              status, reason, delivered, delivered_reason,
+                              data != NULL, data ? data->start_job_time : 0,
+                              data && data->start_job ? data->start_job : "");
+    }
+
+    return g_variant_new(SYSTEMD_MANAGER_STATE_TYPE, self->catalog_version, &apps);
+}
+
 void systemd_manager_connect_callbacks(SystemdManager *self,
                                        GCallback started_cb,
                                        GCallback terminated_cb,
@@ -400,6 +1258,67 @@ void systemd_manager_connect_callbacks(SystemdManager *self,
         g_signal_connect_swapped(self, "terminated", terminated_cb, data);
 }
 
+void systemd_manager_connect_status_callback(SystemdManager *self,
+                                             GCallback status_cb,
+                                             void *data)
+{
+    if (status_cb)
+        g_signal_connect_swapped(self, "status-changed", status_cb, data);
+}
+
+void systemd_manager_connect_catalog_callback(SystemdManager *self,
+                                              GCallback catalog_cb,
+                                              void *data)
+{
+    if (catalog_cb)
+        g_signal_connect_swapped(self, "catalog-changed", catalog_cb, data);
+}
+
+/*
+ * Set the window during which status changes following a notification for
+ * a given application are collapsed into a single one, 0 disables
+ * coalescing.
+ */
+void systemd_manager_set_coalesce_window(SystemdManager *self, guint window_ms)
+{
+    g_return_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self));
+
+    self->coalesce_window = window_ms;
+}
+
+/*
+ * Number of status changes which were not delivered because they were
+ * superseded within the coalescing window.
+ */
+guint64 systemd_manager_get_suppressed_events(SystemdManager *self)
+{
+    g_return_val_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self), 0);
+
+    return self->suppressed_events;
+}
+
+/*
+ * Queue a command for execution in the main context owning the manager.
+ * Unlike g_main_context_invoke(), the command is never run synchronously,
+ * even when the calling thread could acquire the context, so it is safe to
+ * call from any thread at any time. This is the only way other threads may
+ * use the manager, or the AppInfo objects it hands out.
+ */
+void systemd_manager_invoke(SystemdManager *self,
+                            GSourceFunc command,
+                            gpointer data,
+                            GDestroyNotify notify)
+{
+    g_return_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self));
+
+    GSource *source = g_idle_source_new();
+    g_source_set_priority(source, G_PRIORITY_DEFAULT);
+    g_source_set_callback(source, command, data, notify);
+    g_source_set_name(source, "[applaunchd] systemd manager command");
+    g_source_attach(source, self->context);
+    g_source_unref(source);
+}
+
 /*
  * Search the applications list for an app which matches the provided app-id
  * and return the corresponding AppInfo object.
@@ -408,14 +1327,9 @@ AppInfo *systemd_manager_get_app_info(SystemdManager *self, const gchar *app_id)
 {
     g_return_val_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self), NULL);
 
-    guint len = g_list_length(self->apps_list);
-
-    for (guint i = 0; i < len; i++) {
-        AppInfo *app_info = g_list_nth_data(self->apps_list, i);
-
-        if (g_strcmp0(app_info_get_app_id(app_info), app_id) == 0)
-            return app_info;
-    }
+    AppInfo *app_info = find_app_info(self->apps_list, app_id);
+    if (app_info)
+        return app_info;
 
     g_warning("Unable to find application with ID '%s'", app_id);
 
@@ -429,17 +1343,72 @@ GList *systemd_manager_get_app_list(SystemdManager *self)
     return self->apps_list;
 }
 
+/*
+ * Version of the applications list, incremented every time it is rebuilt.
+ * It starts from a random value per instance, unless restored from a saved
+ * state.
+ */
+guint64 systemd_manager_get_catalog_version(SystemdManager *self)
+{
+    g_return_val_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self), 0);
+
+    return self->catalog_version;
+}
+
+/*
+ * Ask systemd to start the given service, keeping the path of the start
+ * job in `runtime_data` if not NULL.
+ */
+static gboolean systemd_manager_start_unit(SystemdManager *self,
+                                           const gchar *app_id,
+                                           const gchar *service,
+                                           struct systemd_runtime_data *runtime_data)
+{
+    GError *error = NULL;
+    gchar *job = NULL;
+    gint64 start = g_get_monotonic_time();
+    launch_trace_mark(app_id, LAUNCH_STAGE_START_UNIT_ISSUED, start);
+    gboolean ret = systemd1_manager_start_unit(self->conn,
+                                               self->bus_name,
+                                               service,
+                                               "replace",
+                                               runtime_data ? &job : NULL,
+                                               &error);
+    systemd_manager_record_call(self, SYSTEMD_CALL_START_UNIT, start);
+    metric_inc(self->starts);
+    if (!ret) {
+        g_critical("Failed to issue method call: %s", error ? error->message : "unspecified");
+	g_error_free(error);
+        return FALSE;
+    }
+    launch_trace_mark(app_id, LAUNCH_STAGE_JOB_QUEUED, g_get_monotonic_time());
+
+    // A previous start job got replaced, its removal is of no interest
+    if (runtime_data) {
+        g_free(runtime_data->start_job);
+        runtime_data->start_job = job;
+    }
+
+    return TRUE;
+}
+
 /*
  * Start an application by executing its service.
  */
 gboolean systemd_manager_start_app(SystemdManager *self,
                                    AppInfo *app_info)
 {
-    g_return_val_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self), FALSE);
-    g_return_val_if_fail(APPLAUNCHD_IS_APP_INFO(app_info), FALSE);
+    return systemd_manager_start_app_full(self, app_info, 0);
+}
+
+static gboolean systemd_manager_do_start_app(SystemdManager *self,
+                                             AppInfo *app_info,
+                                             gint64 request_time)
+{
 
     AppStatus app_status = app_info_get_status(app_info);
     const gchar *app_id = app_info_get_app_id(app_info);
+    struct systemd_runtime_data *runtime_data;
 
     switch (app_status) {
     case APP_STATUS_STARTING:
@@ -451,10 +1420,30 @@ gboolean systemd_manager_start_app(SystemdManager *self,
         /*
         * The application may be running in the background, notify
         * subscribers it should be activated/brought to the foreground.
+        * This is an explicit request, so it is never coalesced.
         */
+        systemd_manager_flush_status(self, app_info);
+        g_signal_emit(self, signals[STATUS_CHANGED], 0, app_id,
+                      APP_STATUS_RUNNING, APP_FAILURE_NONE, APP_NOTIFY_STARTED);
         g_signal_emit(self, signals[STARTED], 0, app_id);
         return TRUE;
+    case APP_STATUS_STOPPING:
+        /*
+        * The unit is still tracked, queueing a new start job is enough,
+        * the status will follow its state changes.
+        */
+        g_debug("Application '%s' is stopping, restarting it", app_id);
+        launch_trace_begin(app_id, request_time);
+        launch_trace_mark(app_id, LAUNCH_STAGE_LOOKUP_DONE, g_get_monotonic_time());
+        runtime_data = app_info_get_runtime_data(app_info);
+        if (runtime_data) {
+            runtime_data->start_time = g_get_monotonic_time();
+            runtime_data->start_job_time = runtime_data->start_time;
+        }
+        return systemd_manager_start_unit(self, app_id, app_info_get_service(app_info),
+                                          runtime_data);
     case APP_STATUS_INACTIVE:
+    case APP_STATUS_FAILED:
         // Fall through and start the application
         break;
     default:
@@ -462,75 +1451,64 @@ gboolean systemd_manager_start_app(SystemdManager *self,
         return FALSE;
     }
 
-    gchar *esc_service = NULL;
     const gchar *service = app_info_get_service(app_info);
-    struct systemd_runtime_data *runtime_data;
 
-    runtime_data = g_new0(struct systemd_runtime_data, 1);
-    if (!runtime_data) {
-        g_critical("Unable to allocate runtime data structure for '%s'", app_id);
-        return FALSE;
-    }
+    launch_trace_begin(app_id, request_time);
+    launch_trace_mark(app_id, LAUNCH_STAGE_LOOKUP_DONE, g_get_monotonic_time());
 
-    // Get the escaped unit name in the systemd hierarchy
-    sd_bus_path_encode("/org/freedesktop/systemd1/unit", service, &esc_service);
-    g_debug("Trying to start service '%s', unit path '%s'", service, esc_service);
-
-    runtime_data->mgr = self;
-    runtime_data->esc_service = esc_service;
-
-    GError *error = NULL;
-    Systemd1Unit *proxy = systemd1_unit_proxy_new_sync(self->conn,
-						       G_DBUS_PROXY_FLAGS_NONE,
-						       "org.freedesktop.systemd1",
-						       esc_service,
-						       NULL,
-						       &error);
-    if (!proxy) {
-        g_critical("Failed to create org.freedesktop.systemd1.Unit proxy: %s",
-		   error ? error->message : "unspecified");
-	g_error_free(error);
-	goto finish;
-    }
-    runtime_data->proxy = proxy;
-
-    app_info_set_runtime_data(app_info, runtime_data);
-    g_signal_connect(proxy,
-		     "g-properties-changed",
-		     G_CALLBACK(unit_properties_changed_cb),
-		     app_info);
+    g_debug("Trying to start service '%s'", service);
+    runtime_data = systemd_manager_track_app(self, app_info);
+    if (!runtime_data)
+        goto finish;
+    runtime_data->start_time = g_get_monotonic_time();
+    runtime_data->start_job_time = runtime_data->start_time;
 
     // The application is now starting, wait for notification to mark it running
-    g_debug("Application %s is now being started", app_info_get_app_id(app_info));
-    app_info_set_status(app_info, APP_STATUS_STARTING);
-
-    if (!systemd1_manager_call_start_unit_sync(self->proxy,
-					       service,
-					       "replace",
-					       NULL,
-					       NULL,
-					       &error)) {
+    systemd_manager_set_app_status(self, app_info, APP_STATUS_STARTING, APP_FAILURE_NONE);
 
-        g_critical("Failed to issue method call: %s", error ? error->message : "unspecified");
-	g_error_free(error);
+    if (!systemd_manager_start_unit(self, app_id, service, runtime_data)) {
+        app_info_set_runtime_data(app_info, NULL, NULL);
+        systemd_manager_set_app_status(self, app_info, APP_STATUS_FAILED,
+                                       APP_FAILURE_START_REQUEST);
         goto finish;
     }
 
     return TRUE;
 
 finish:
-    if(runtime_data->esc_service)
-        g_free(runtime_data->esc_service);
-    g_free(runtime_data);
+    launch_trace_fail(app_id);
     return FALSE;
 }
 
+/*
+ * Same as systemd_manager_start_app(), `request_time` being the time at
+ * which the request was received for the launch timeline (now if 0).
+ */
+gboolean systemd_manager_start_app_full(SystemdManager *self,
+                                        AppInfo *app_info,
+                                        gint64 request_time)
+{
+    g_return_val_if_fail(APPLAUNCHD_IS_SYSTEMD_MANAGER(self), FALSE);
+    g_return_val_if_fail(APPLAUNCHD_IS_APP_INFO(app_info), FALSE);
+
+    APPLAUNCHD_PROBE2(start__app__begin, app_info_get_app_id(app_info),
+                      app_info_get_status(app_info));
+    gboolean ret = systemd_manager_do_start_app(self, app_info, request_time);
+    APPLAUNCHD_PROBE3(start__app__end, app_info_get_app_id(app_info),
+                      app_info_get_status(app_info), ret);
+
+    return ret;
+}
+
 void systemd_manager_free_runtime_data(gpointer data)
 {
     struct systemd_runtime_data *runtime_data = data;
 
     g_return_if_fail(runtime_data != NULL);
 
+    // This may run from the unit's own callback, see systemd1_unit_free()
+    systemd1_unit_free(runtime_data->unit);
     g_free(runtime_data->esc_service);
+    g_free(runtime_data->start_job);
     g_free(runtime_data);
 }
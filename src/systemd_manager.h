@@ -17,21 +17,55 @@ G_BEGIN_DECLS
 G_DECLARE_FINAL_TYPE(SystemdManager, systemd_manager,
                      APPLAUNCHD, SYSTEMD_MANAGER, GObject);
 
+void systemd_manager_set_use_private_socket(gboolean use);
+
 SystemdManager *systemd_manager_get_default(void);
 
+SystemdManager *systemd_manager_get_default_with_state(GVariant *state,
+                                                       gboolean *restored);
+
 void systemd_manager_connect_callbacks(SystemdManager *self,
                                        GCallback started_cb,
                                        GCallback terminated_cb,
                                        void *data);
 
+void systemd_manager_connect_status_callback(SystemdManager *self,
+                                             GCallback status_cb,
+                                             void *data);
+
+void systemd_manager_connect_catalog_callback(SystemdManager *self,
+                                              GCallback catalog_cb,
+                                              void *data);
+
+void systemd_manager_set_coalesce_window(SystemdManager *self,
+                                         guint window_ms);
+
+guint64 systemd_manager_get_suppressed_events(SystemdManager *self);
+
+void systemd_manager_invoke(SystemdManager *self,
+                            GSourceFunc command,
+                            gpointer data,
+                            GDestroyNotify notify);
+
+/*
+ * The functions below must be called from the manager's main context.
+ */
 AppInfo *systemd_manager_get_app_info(SystemdManager *self,
                                       const gchar *app_id);
 
 GList *systemd_manager_get_app_list(SystemdManager *self);
 
+guint64 systemd_manager_get_catalog_version(SystemdManager *self);
+
+GVariant *systemd_manager_save_state(SystemdManager *self);
+
 gboolean systemd_manager_start_app(SystemdManager *self,
                                    AppInfo *app_info);
 
+gboolean systemd_manager_start_app_full(SystemdManager *self,
+                                        AppInfo *app_info,
+                                        gint64 request_time);
+
 G_END_DECLS
 
 void systemd_manager_free_runtime_data(gpointer data);
@@ -0,0 +1,594 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include <systemd/sd-bus.h>
+
+#include "fake-systemd.h"
+
+#define SYSTEMD1_BUS_NAME "org.freedesktop.systemd1"
+#define SYSTEMD1_PATH "/org/freedesktop/systemd1"
+
+static const gchar manager_xml[] =
+    "<node>"
+    "  <interface name='org.freedesktop.systemd1.Manager'>"
+    "    <method name='ListUnitFilesByPatterns'>"
+    "      <arg type='as' direction='in'/>"
+    "      <arg type='as' direction='in'/>"
+    "      <arg type='a(ss)' direction='out'/>"
+    "    </method>"
+    "    <method name='StartUnit'>"
+    "      <arg type='s' direction='in'/>"
+    "      <arg type='s' direction='in'/>"
+    "      <arg type='o' direction='out'/>"
+    "    </method>"
+    "    <method name='Subscribe'/>"
+    "    <signal name='UnitFilesChanged'/>"
+    "    <signal name='Reloading'>"
+    "      <arg type='b'/>"
+    "    </signal>"
+    "    <signal name='JobRemoved'>"
+    "      <arg type='u'/>"
+    "      <arg type='o'/>"
+    "      <arg type='s'/>"
+    "      <arg type='s'/>"
+    "    </signal>"
+    "  </interface>"
+    "</node>";
+
+static const gchar unit_xml[] =
+    "<node>"
+    "  <interface name='org.freedesktop.systemd1.Unit'>"
+    "    <property name='ActiveState' type='s' access='read'/>"
+    "    <property name='Description' type='s' access='read'/>"
+    "    <property name='InactiveExitTimestampMonotonic' type='t' access='read'/>"
+    "    <property name='ActiveEnterTimestampMonotonic' type='t' access='read'/>"
+    "  </interface>"
+    "  <interface name='org.freedesktop.systemd1.Service'>"
+    "    <property name='Result' type='s' access='read'/>"
+    "  </interface>"
+    "</node>";
+
+/*
+ * One step of a unit state change, each one being reported by its own
+ * PropertiesChanged signal.
+ */
+typedef struct {
+    const gchar *active_state;
+    gboolean inactive_exit;
+    gboolean active_enter;
+    const gchar *result;
+} FakeStep;
+
+static const FakeStep run_steps[] = {
+    { "inactive", FALSE, FALSE, "success" },
+    { "activating", TRUE, FALSE, "success" },
+    { "active", FALSE, TRUE, "success" },
+    { NULL },
+};
+
+static const FakeStep exit_steps[] = {
+    { "inactive", FALSE, FALSE, "success" },
+    { "inactive", TRUE, TRUE, "success" },
+    { NULL },
+};
+
+static const FakeStep fail_steps[] = {
+    { "inactive", FALSE, FALSE, "success" },
+    { "activating", TRUE, FALSE, "success" },
+    { "failed", FALSE, FALSE, "exit-code" },
+    { NULL },
+};
+
+static const FakeStep crash_steps[] = {
+    { "inactive", FALSE, FALSE, "success" },
+    { "activating", TRUE, FALSE, "success" },
+    { "failed", FALSE, FALSE, "signal" },
+    { NULL },
+};
+
+// The start job gets done without the unit leaving "inactive"
+static const FakeStep unmet_steps[] = {
+    { "inactive", FALSE, FALSE, "success" },
+    { NULL },
+};
+
+static const FakeStep stop_steps[] = {
+    { "deactivating", FALSE, FALSE, "success" },
+    { "inactive", FALSE, FALSE, "success" },
+    { NULL },
+};
+
+typedef struct {
+    FakeSystemd *fake;
+    gchar *app_id;
+    gchar *service;
+    gchar *path;
+    guint registration_id;
+
+    // Only accessed from the service thread, but for the behavior
+    const gchar *active_state;
+    const gchar *result;
+    guint64 inactive_exit_timestamp;
+    guint64 active_enter_timestamp;
+    const FakeStep *steps;
+    gint behavior;
+    // Start job removed once done with the steps, along with its result
+    guint job_id;
+    gchar *job;
+    const gchar *job_result;
+} FakeUnit;
+
+struct _FakeSystemd {
+    GTestDBus *bus;
+    GDBusConnection *conn;
+    GDBusNodeInfo *manager_info;
+    GDBusNodeInfo *unit_info;
+    guint manager_registration_id;
+
+    GMainContext *context;
+    GMainLoop *loop;
+    GThread *thread;
+
+    // Peer-to-peer server standing for systemd's private socket
+    GDBusServer *server;
+    // Connections to it, only accessed from the service thread
+    GPtrArray *peers;
+
+    // FakeUnit by service name, and by application ID
+    GHashTable *units;
+    GHashTable *units_by_app;
+    // Unit files listed without a unit object behind them
+    GPtrArray *extra_files;
+    gint start_count;
+    gint description_count;
+};
+
+static void fake_unit_free(gpointer data)
+{
+    FakeUnit *unit = data;
+
+    g_free(unit->app_id);
+    g_free(unit->service);
+    g_free(unit->path);
+    g_free(unit->job);
+    g_free(unit);
+}
+
+/*
+ * Run `func` in the service thread.
+ */
+static void fake_systemd_invoke(FakeSystemd *self, GSourceFunc func, gpointer data)
+{
+    GSource *source = g_idle_source_new();
+
+    g_source_set_callback(source, func, data, NULL);
+    g_source_attach(source, self->context);
+    g_source_unref(source);
+}
+
+static void fake_unit_emit_changed(FakeUnit *unit)
+{
+    GVariantBuilder changed;
+
+    g_variant_builder_init(&changed, G_VARIANT_TYPE_VARDICT);
+    g_variant_builder_add(&changed, "{sv}", "ActiveState",
+                          g_variant_new_string(unit->active_state));
+    g_variant_builder_add(&changed, "{sv}", "InactiveExitTimestampMonotonic",
+                          g_variant_new_uint64(unit->inactive_exit_timestamp));
+    g_variant_builder_add(&changed, "{sv}", "ActiveEnterTimestampMonotonic",
+                          g_variant_new_uint64(unit->active_enter_timestamp));
+
+    GVariant *parameters = g_variant_ref_sink(g_variant_new("(sa{sv}@as)",
+                                                            "org.freedesktop.systemd1.Unit",
+                                                            &changed,
+                                                            g_variant_new_strv(NULL, 0)));
+
+    // Like systemd, signals go to every peer-to-peer connection
+    g_dbus_connection_emit_signal(unit->fake->conn, NULL, unit->path,
+                                  "org.freedesktop.DBus.Properties", "PropertiesChanged",
+                                  parameters, NULL);
+    for (guint i = 0; i < unit->fake->peers->len; i++)
+        g_dbus_connection_emit_signal(unit->fake->peers->pdata[i], NULL, unit->path,
+                                      "org.freedesktop.DBus.Properties", "PropertiesChanged",
+                                      parameters, NULL);
+    g_variant_unref(parameters);
+}
+
+static void fake_unit_emit_job_removed(FakeUnit *unit)
+{
+    GVariant *parameters = g_variant_ref_sink(g_variant_new("(uoss)", unit->job_id, unit->job,
+                                                            unit->service, unit->job_result));
+
+    g_dbus_connection_emit_signal(unit->fake->conn, NULL, SYSTEMD1_PATH,
+                                  "org.freedesktop.systemd1.Manager", "JobRemoved",
+                                  parameters, NULL);
+    for (guint i = 0; i < unit->fake->peers->len; i++)
+        g_dbus_connection_emit_signal(unit->fake->peers->pdata[i], NULL, SYSTEMD1_PATH,
+                                      "org.freedesktop.systemd1.Manager", "JobRemoved",
+                                      parameters, NULL);
+    g_variant_unref(parameters);
+}
+
+/*
+ * Apply the next step of the current state change, one per main loop
+ * iteration so that each gets its own signal.
+ */
+static gboolean fake_unit_step_cb(gpointer user_data)
+{
+    FakeUnit *unit = user_data;
+    const FakeStep *step = unit->steps;
+    gint64 now = g_get_monotonic_time();
+
+    unit->active_state = step->active_state;
+    unit->result = step->result;
+    if (step->inactive_exit)
+        unit->inactive_exit_timestamp = now;
+    if (step->active_enter)
+        unit->active_enter_timestamp = now;
+    fake_unit_emit_changed(unit);
+
+    unit->steps++;
+    if (!unit->steps->active_state) {
+        unit->steps = NULL;
+        // Like systemd, after the unit changes the job led to
+        if (unit->job) {
+            fake_unit_emit_job_removed(unit);
+            g_clear_pointer(&unit->job, g_free);
+        }
+        return G_SOURCE_REMOVE;
+    }
+
+    return G_SOURCE_CONTINUE;
+}
+
+/*
+ * Go through `steps`, then remove `job` with `job_result` if not NULL.
+ */
+static void fake_unit_run(FakeUnit *unit, const FakeStep *steps,
+                          guint job_id, const gchar *job, const gchar *job_result)
+{
+    if (unit->steps)
+        return;
+
+    unit->steps = steps;
+    unit->job_id = job_id;
+    unit->job = g_strdup(job);
+    unit->job_result = job_result;
+    fake_systemd_invoke(unit->fake, fake_unit_step_cb, unit);
+}
+
+static gboolean fake_unit_stop_cb(gpointer user_data)
+{
+    FakeUnit *unit = user_data;
+
+    fake_unit_run(unit, stop_steps, 0, NULL, NULL);
+
+    return G_SOURCE_REMOVE;
+}
+
+static void manager_method_call(GDBusConnection *conn,
+                                const gchar *sender,
+                                const gchar *object_path,
+                                const gchar *interface_name,
+                                const gchar *method_name,
+                                GVariant *parameters,
+                                GDBusMethodInvocation *invocation,
+                                gpointer user_data)
+{
+    FakeSystemd *self = user_data;
+
+    if (g_strcmp0(method_name, "ListUnitFilesByPatterns") == 0) {
+        GVariantBuilder files;
+        GHashTableIter iter;
+        FakeUnit *unit;
+
+        g_variant_builder_init(&files, G_VARIANT_TYPE("a(ss)"));
+        g_variant_builder_add(&files, "(ss)", "/usr/lib/systemd/system/agl-app@.service",
+                              "static");
+        // Extra files go first, the daemon handles them last
+        for (guint i = 0; i < self->extra_files->len; i++) {
+            g_autofree gchar *file = g_build_filename("/etc/systemd/system",
+                                                      self->extra_files->pdata[i], NULL);
+            g_variant_builder_add(&files, "(ss)", file, "enabled");
+        }
+        g_hash_table_iter_init(&iter, self->units);
+        while (g_hash_table_iter_next(&iter, NULL, (gpointer *)&unit)) {
+            g_autofree gchar *file = g_build_filename("/etc/systemd/system", unit->service, NULL);
+            g_variant_builder_add(&files, "(ss)", file, "enabled");
+        }
+        g_dbus_method_invocation_return_value(invocation, g_variant_new("(a(ss))", &files));
+    } else if (g_strcmp0(method_name, "StartUnit") == 0) {
+        const gchar *name, *mode;
+        g_variant_get(parameters, "(&s&s)", &name, &mode);
+
+        FakeUnit *unit = g_hash_table_lookup(self->units, name);
+        if (!unit) {
+            g_dbus_method_invocation_return_dbus_error(invocation,
+                                                       "org.freedesktop.systemd1.NoSuchUnit",
+                                                       "Unit not found");
+            return;
+        }
+
+        guint job_id = g_atomic_int_add(&self->start_count, 1) + 1;
+        g_autofree gchar *job = g_strdup_printf(SYSTEMD1_PATH "/job/%u", job_id);
+        g_dbus_method_invocation_return_value(invocation, g_variant_new("(o)", job));
+
+        switch (g_atomic_int_get(&unit->behavior)) {
+        case FAKE_UNIT_EXIT:
+            fake_unit_run(unit, exit_steps, job_id, job, "done");
+            break;
+        case FAKE_UNIT_FAIL:
+            fake_unit_run(unit, fail_steps, job_id, job, "failed");
+            break;
+        case FAKE_UNIT_CRASH:
+            fake_unit_run(unit, crash_steps, job_id, job, "failed");
+            break;
+        case FAKE_UNIT_UNMET:
+            fake_unit_run(unit, unmet_steps, job_id, job, "done");
+            break;
+        case FAKE_UNIT_DEPENDENCY:
+            fake_unit_run(unit, unmet_steps, job_id, job, "dependency");
+            break;
+        default:
+            fake_unit_run(unit, run_steps, job_id, job, "done");
+            break;
+        }
+    } else {
+        g_dbus_method_invocation_return_value(invocation, NULL);
+    }
+}
+
+static GVariant *unit_get_property(GDBusConnection *conn,
+                                   const gchar *sender,
+                                   const gchar *object_path,
+                                   const gchar *interface_name,
+                                   const gchar *property_name,
+                                   GError **error,
+                                   gpointer user_data)
+{
+    FakeUnit *unit = user_data;
+
+    if (g_strcmp0(property_name, "ActiveState") == 0)
+        return g_variant_new_string(unit->active_state);
+    if (g_strcmp0(property_name, "Description") == 0) {
+        g_atomic_int_inc(&unit->fake->description_count);
+        return g_variant_new_string(unit->app_id);
+    }
+    if (g_strcmp0(property_name, "InactiveExitTimestampMonotonic") == 0)
+        return g_variant_new_uint64(unit->inactive_exit_timestamp);
+    if (g_strcmp0(property_name, "ActiveEnterTimestampMonotonic") == 0)
+        return g_variant_new_uint64(unit->active_enter_timestamp);
+    if (g_strcmp0(property_name, "Result") == 0)
+        return g_variant_new_string(unit->result);
+
+    g_set_error(error, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_PROPERTY,
+                "Unknown property %s", property_name);
+    return NULL;
+}
+
+static const GDBusInterfaceVTable manager_vtable = {
+    manager_method_call, NULL, NULL, { NULL }
+};
+
+static const GDBusInterfaceVTable unit_vtable = {
+    NULL, unit_get_property, NULL, { NULL }
+};
+
+static gpointer fake_systemd_thread(gpointer data)
+{
+    FakeSystemd *self = data;
+
+    g_main_context_push_thread_default(self->context);
+    g_main_loop_run(self->loop);
+    g_main_context_pop_thread_default(self->context);
+
+    return NULL;
+}
+
+static void fake_unit_register(FakeUnit *unit, GDBusConnection *conn)
+{
+    for (guint i = 0; unit->fake->unit_info->interfaces[i]; i++) {
+        guint id = g_dbus_connection_register_object(conn, unit->path,
+                                                     unit->fake->unit_info->interfaces[i],
+                                                     &unit_vtable, unit, NULL, NULL);
+        g_assert_cmpuint(id, !=, 0);
+    }
+}
+
+static void peer_closed_cb(GDBusConnection *conn,
+                           gboolean remote_peer_vanished,
+                           GError *error,
+                           gpointer user_data)
+{
+    FakeSystemd *self = user_data;
+
+    g_ptr_array_remove(self->peers, conn);
+}
+
+/*
+ * Export the manager and units on a new peer-to-peer connection, from the
+ * service thread.
+ */
+static gboolean new_connection_cb(GDBusServer *server,
+                                  GDBusConnection *conn,
+                                  gpointer user_data)
+{
+    FakeSystemd *self = user_data;
+    GHashTableIter iter;
+    FakeUnit *unit;
+
+    guint id = g_dbus_connection_register_object(conn, SYSTEMD1_PATH,
+                                                 self->manager_info->interfaces[0],
+                                                 &manager_vtable, self, NULL, NULL);
+    g_assert_cmpuint(id, !=, 0);
+
+    g_hash_table_iter_init(&iter, self->units);
+    while (g_hash_table_iter_next(&iter, NULL, (gpointer *)&unit))
+        fake_unit_register(unit, conn);
+
+    g_ptr_array_add(self->peers, g_object_ref(conn));
+    g_signal_connect(conn, "closed", G_CALLBACK(peer_closed_cb), self);
+
+    return TRUE;
+}
+
+static void fake_systemd_add_unit(FakeSystemd *self, const gchar *app_id)
+{
+    FakeUnit *unit = g_new0(FakeUnit, 1);
+
+    unit->fake = self;
+    unit->app_id = g_strdup(app_id);
+    unit->service = g_strdup_printf("agl-app@%s.service", app_id);
+    sd_bus_path_encode(SYSTEMD1_PATH "/unit", unit->service, &unit->path);
+    unit->active_state = "inactive";
+    unit->result = "success";
+    unit->behavior = FAKE_UNIT_RUN;
+
+    fake_unit_register(unit, self->conn);
+
+    g_hash_table_insert(self->units, unit->service, unit);
+    g_hash_table_insert(self->units_by_app, unit->app_id, unit);
+}
+
+FakeSystemd *fake_systemd_new_full(const gchar *const *app_ids,
+                                   const gchar *const *extra_files)
+{
+    FakeSystemd *self = g_new0(FakeSystemd, 1);
+    GError *error = NULL;
+
+    self->bus = g_test_dbus_new(G_TEST_DBUS_NONE);
+    g_test_dbus_up(self->bus);
+    g_setenv("DBUS_SYSTEM_BUS_ADDRESS", g_test_dbus_get_bus_address(self->bus), TRUE);
+
+    self->context = g_main_context_new();
+    self->loop = g_main_loop_new(self->context, FALSE);
+    self->units = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, fake_unit_free);
+    self->units_by_app = g_hash_table_new(g_str_hash, g_str_equal);
+    self->extra_files = g_ptr_array_new_with_free_func(g_free);
+    self->peers = g_ptr_array_new_with_free_func(g_object_unref);
+    self->manager_info = g_dbus_node_info_new_for_xml(manager_xml, &error);
+    g_assert_no_error(error);
+    self->unit_info = g_dbus_node_info_new_for_xml(unit_xml, &error);
+    g_assert_no_error(error);
+
+    // Calls get dispatched to the thread-default context at registration
+    g_main_context_push_thread_default(self->context);
+
+    self->conn = g_dbus_connection_new_for_address_sync(g_test_dbus_get_bus_address(self->bus),
+                                                        G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT |
+                                                        G_DBUS_CONNECTION_FLAGS_MESSAGE_BUS_CONNECTION,
+                                                        NULL, NULL, &error);
+    g_assert_no_error(error);
+
+    self->manager_registration_id =
+        g_dbus_connection_register_object(self->conn, SYSTEMD1_PATH,
+                                          self->manager_info->interfaces[0],
+                                          &manager_vtable, self, NULL, &error);
+    g_assert_no_error(error);
+
+    for (guint i = 0; app_ids && app_ids[i]; i++)
+        fake_systemd_add_unit(self, app_ids[i]);
+    for (guint i = 0; extra_files && extra_files[i]; i++)
+        g_ptr_array_add(self->extra_files, g_strdup(extra_files[i]));
+
+    // Its new connections get emitted in the service thread
+    g_autofree gchar *guid = g_dbus_generate_guid();
+    g_autofree gchar *address = g_strdup_printf("unix:tmpdir=%s", g_get_tmp_dir());
+    self->server = g_dbus_server_new_sync(address, G_DBUS_SERVER_FLAGS_NONE, guid,
+                                          NULL, NULL, &error);
+    g_assert_no_error(error);
+    g_signal_connect(self->server, "new-connection", G_CALLBACK(new_connection_cb), self);
+    g_dbus_server_start(self->server);
+
+    g_main_context_pop_thread_default(self->context);
+
+    GVariant *reply = g_dbus_connection_call_sync(self->conn, "org.freedesktop.DBus",
+                                                  "/org/freedesktop/DBus", "org.freedesktop.DBus",
+                                                  "RequestName",
+                                                  g_variant_new("(su)", SYSTEMD1_BUS_NAME, 0),
+                                                  G_VARIANT_TYPE("(u)"), G_DBUS_CALL_FLAGS_NONE,
+                                                  -1, NULL, &error);
+    g_assert_no_error(error);
+    g_variant_unref(reply);
+
+    self->thread = g_thread_new("fake-systemd", fake_systemd_thread, self);
+
+    return self;
+}
+
+FakeSystemd *fake_systemd_new(const gchar *const *app_ids)
+{
+    return fake_systemd_new_full(app_ids, NULL);
+}
+
+static gboolean fake_systemd_quit_cb(gpointer user_data)
+{
+    FakeSystemd *self = user_data;
+
+    g_main_loop_quit(self->loop);
+
+    return G_SOURCE_REMOVE;
+}
+
+void fake_systemd_free(FakeSystemd *self)
+{
+    fake_systemd_invoke(self, fake_systemd_quit_cb, self);
+    g_thread_join(self->thread);
+
+    g_dbus_server_stop(self->server);
+    g_object_unref(self->server);
+    for (guint i = 0; i < self->peers->len; i++) {
+        g_signal_handlers_disconnect_by_data(self->peers->pdata[i], self);
+        g_dbus_connection_close_sync(self->peers->pdata[i], NULL, NULL);
+    }
+    g_ptr_array_unref(self->peers);
+
+    g_dbus_connection_close_sync(self->conn, NULL, NULL);
+    g_object_unref(self->conn);
+    g_hash_table_unref(self->units_by_app);
+    g_hash_table_unref(self->units);
+    g_ptr_array_unref(self->extra_files);
+    g_dbus_node_info_unref(self->unit_info);
+    g_dbus_node_info_unref(self->manager_info);
+    g_main_loop_unref(self->loop);
+    g_main_context_unref(self->context);
+
+    g_test_dbus_down(self->bus);
+    g_object_unref(self->bus);
+    g_free(self);
+}
+
+void fake_systemd_set_behavior(FakeSystemd *self,
+                               const gchar *app_id,
+                               FakeUnitBehavior behavior)
+{
+    FakeUnit *unit = g_hash_table_lookup(self->units_by_app, app_id);
+
+    g_assert_nonnull(unit);
+    g_atomic_int_set(&unit->behavior, behavior);
+}
+
+void fake_systemd_stop(FakeSystemd *self, const gchar *app_id)
+{
+    FakeUnit *unit = g_hash_table_lookup(self->units_by_app, app_id);
+
+    g_assert_nonnull(unit);
+    fake_systemd_invoke(self, fake_unit_stop_cb, unit);
+}
+
+const gchar *fake_systemd_get_private_address(FakeSystemd *self)
+{
+    return g_dbus_server_get_client_address(self->server);
+}
+
+guint fake_systemd_get_start_count(FakeSystemd *self)
+{
+    return g_atomic_int_get(&self->start_count);
+}
+
+guint fake_systemd_get_description_count(FakeSystemd *self)
+{
+    return g_atomic_int_get(&self->description_count);
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#ifndef FAKESYSTEMD_H
+#define FAKESYSTEMD_H
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Minimal org.freedesktop.systemd1 service on a private bus, exposing one
+ * agl-app@<app-id>.service unit per application. It is served from its own
+ * thread, so that the code under test may use blocking calls, and
+ * DBUS_SYSTEM_BUS_ADDRESS points at its bus once created.
+ */
+typedef struct _FakeSystemd FakeSystemd;
+
+/*
+ * What a unit does when started.
+ */
+typedef enum {
+    // Goes through "activating" to "active"
+    FAKE_UNIT_RUN,
+    // Runs and exits before the next signal, only moving its timestamps
+    FAKE_UNIT_EXIT,
+    // Goes through "activating" to "failed", with an exit code
+    FAKE_UNIT_FAIL,
+    // Goes through "activating" to "failed", killed by a signal
+    FAKE_UNIT_CRASH,
+    // Stays "inactive", its start job being done as a condition was not met
+    FAKE_UNIT_UNMET,
+    // Stays "inactive", its start job failing on a dependency
+    FAKE_UNIT_DEPENDENCY
+} FakeUnitBehavior;
+
+/*
+ * Besides the units of `app_ids`, list the unit files of `extra_files`
+ * without any unit object behind them, e.g. duplicates.
+ */
+FakeSystemd *fake_systemd_new_full(const gchar *const *app_ids,
+                                   const gchar *const *extra_files);
+
+FakeSystemd *fake_systemd_new(const gchar *const *app_ids);
+
+void fake_systemd_free(FakeSystemd *self);
+
+void fake_systemd_set_behavior(FakeSystemd *self,
+                               const gchar *app_id,
+                               FakeUnitBehavior behavior);
+
+// Stop the unit of an active application, through "deactivating"
+void fake_systemd_stop(FakeSystemd *self, const gchar *app_id);
+
+/*
+ * Address of the peer-to-peer server exposing the same objects, as systemd
+ * does on its private socket.
+ */
+const gchar *fake_systemd_get_private_address(FakeSystemd *self);
+
+// Number of StartUnit calls received
+guint fake_systemd_get_start_count(FakeSystemd *self);
+
+// Number of unit Description queries received
+guint fake_systemd_get_description_count(FakeSystemd *self);
+
+G_END_DECLS
+
+#endif
@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include "app_state.h"
+
+/*
+ * One unit state change, with whether a start job is pending, and the
+ * status and legacy notification it is expected to lead to.
+ */
+typedef struct {
+    UnitState unit_state;
+    gboolean start_pending;
+    AppStatus status;
+    AppNotify notify;
+} Step;
+
+static void check_steps(AppStatus status, const Step *steps, gsize n_steps)
+{
+    for (gsize i = 0; i < n_steps; i++) {
+        AppStatus next = app_state_transition(status, steps[i].unit_state,
+                                              steps[i].start_pending);
+
+        g_test_message("%s, unit %d: %s", app_status_to_string(status),
+                       steps[i].unit_state, app_status_to_string(next));
+        g_assert_cmpint(next, ==, steps[i].status);
+        g_assert_cmpint(app_state_notification(status, next), ==, steps[i].notify);
+        status = next;
+    }
+}
+
+static const gchar *unit_states[UNIT_STATE_COUNT] = {
+    [UNIT_STATE_UNKNOWN] = "bogus",
+    [UNIT_STATE_ACTIVE] = "active",
+    [UNIT_STATE_RELOADING] = "reloading",
+    [UNIT_STATE_INACTIVE] = "inactive",
+    [UNIT_STATE_FAILED] = "failed",
+    [UNIT_STATE_ACTIVATING] = "activating",
+    [UNIT_STATE_DEACTIVATING] = "deactivating",
+    [UNIT_STATE_MAINTENANCE] = "maintenance",
+    [UNIT_STATE_REFRESHING] = "refreshing",
+};
+
+static void test_unit_state_from_string(void)
+{
+    for (gint i = 0; i < UNIT_STATE_COUNT; i++)
+        g_assert_cmpint(unit_state_from_string(unit_states[i]), ==, i);
+
+    g_assert_cmpint(unit_state_from_string(NULL), ==, UNIT_STATE_UNKNOWN);
+    g_assert_cmpint(unit_state_from_string(""), ==, UNIT_STATE_UNKNOWN);
+    g_assert_cmpint(unit_state_from_string("Active"), ==, UNIT_STATE_UNKNOWN);
+}
+
+/*
+ * While a start job is pending, "inactive" is the state it was queued in
+ * rather than the unit being done: every other state is handled as usual.
+ */
+static void test_transitions_start_pending(void)
+{
+    for (gint status = 0; status < APP_STATUS_COUNT; status++) {
+        for (gint unit_state = 0; unit_state < UNIT_STATE_COUNT; unit_state++) {
+            AppStatus expected = unit_state == UNIT_STATE_INACTIVE ?
+                APP_STATUS_STARTING : app_state_transition(status, unit_state, FALSE);
+            g_assert_cmpint(app_state_transition(status, unit_state, TRUE), ==, expected);
+        }
+    }
+}
+
+static void test_start(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_INACTIVE, TRUE, APP_STATUS_STARTING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVATING, FALSE, APP_STATUS_STARTING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_STARTED },
+    };
+
+    check_steps(APP_STATUS_INACTIVE, steps, G_N_ELEMENTS(steps));
+}
+
+static void test_failed_start(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_INACTIVE, TRUE, APP_STATUS_STARTING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVATING, FALSE, APP_STATUS_STARTING, APP_NOTIFY_NONE },
+        { UNIT_STATE_FAILED, FALSE, APP_STATUS_FAILED, APP_NOTIFY_TERMINATED },
+        // Started again from there
+        { UNIT_STATE_INACTIVE, TRUE, APP_STATUS_STARTING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_STARTED },
+    };
+
+    check_steps(APP_STATUS_INACTIVE, steps, G_N_ELEMENTS(steps));
+}
+
+/*
+ * The start job is done without the unit leaving "inactive", e.g. as a
+ * condition was not met: the application never ran, so nothing terminated.
+ */
+static void test_start_condition_not_met(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_INACTIVE, TRUE, APP_STATUS_STARTING, APP_NOTIFY_NONE },
+        { UNIT_STATE_INACTIVE, FALSE, APP_STATUS_INACTIVE, APP_NOTIFY_NONE },
+    };
+
+    check_steps(APP_STATUS_INACTIVE, steps, G_N_ELEMENTS(steps));
+}
+
+/*
+ * A crashing application restarted by systemd (Restart=) until it hits its
+ * start limit: each restart terminates it until it is running again.
+ */
+static void test_flap(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_ACTIVATING, FALSE, APP_STATUS_STARTING, APP_NOTIFY_TERMINATED },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_STARTED },
+        { UNIT_STATE_ACTIVATING, FALSE, APP_STATUS_STARTING, APP_NOTIFY_TERMINATED },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_STARTED },
+        { UNIT_STATE_FAILED, FALSE, APP_STATUS_FAILED, APP_NOTIFY_TERMINATED },
+    };
+
+    check_steps(APP_STATUS_RUNNING, steps, G_N_ELEMENTS(steps));
+}
+
+static void test_stop(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_DEACTIVATING, FALSE, APP_STATUS_STOPPING, APP_NOTIFY_NONE },
+        { UNIT_STATE_INACTIVE, FALSE, APP_STATUS_INACTIVE, APP_NOTIFY_TERMINATED },
+    };
+
+    check_steps(APP_STATUS_RUNNING, steps, G_N_ELEMENTS(steps));
+}
+
+/*
+ * Started again while stopping: the stop completes, the application being
+ * terminated, and the queued start job then brings it back up.
+ */
+static void test_restart_while_stopping(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_DEACTIVATING, FALSE, APP_STATUS_STOPPING, APP_NOTIFY_NONE },
+        { UNIT_STATE_DEACTIVATING, TRUE, APP_STATUS_STOPPING, APP_NOTIFY_NONE },
+        { UNIT_STATE_INACTIVE, TRUE, APP_STATUS_STARTING, APP_NOTIFY_TERMINATED },
+        { UNIT_STATE_ACTIVATING, FALSE, APP_STATUS_STARTING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_STARTED },
+    };
+
+    check_steps(APP_STATUS_RUNNING, steps, G_N_ELEMENTS(steps));
+}
+
+/*
+ * A stop aborted by a start before the unit got down was never announced,
+ * so neither is its end.
+ */
+static void test_stop_aborted(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_DEACTIVATING, FALSE, APP_STATUS_STOPPING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_NONE },
+    };
+
+    check_steps(APP_STATUS_RUNNING, steps, G_N_ELEMENTS(steps));
+}
+
+static void test_reload_while_running(void)
+{
+    const Step steps[] = {
+        { UNIT_STATE_RELOADING, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_NONE },
+        { UNIT_STATE_REFRESHING, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_NONE },
+        { UNIT_STATE_ACTIVE, FALSE, APP_STATUS_RUNNING, APP_NOTIFY_NONE },
+    };
+
+    check_steps(APP_STATUS_RUNNING, steps, G_N_ELEMENTS(steps));
+}
+
+/*
+ * Unparsable states never change the status, whatever it is.
+ */
+static void test_unknown_state(void)
+{
+    for (gint status = 0; status < APP_STATUS_COUNT; status++) {
+        g_assert_cmpint(app_state_transition(status, UNIT_STATE_UNKNOWN, FALSE), ==, status);
+        g_assert_cmpint(app_state_notification(status, status), ==, APP_NOTIFY_NONE);
+    }
+}
+
+static void test_status_to_string(void)
+{
+    g_assert_cmpstr(app_status_to_string(APP_STATUS_INACTIVE), ==, "inactive");
+    g_assert_cmpstr(app_status_to_string(APP_STATUS_STARTING), ==, "starting");
+    g_assert_cmpstr(app_status_to_string(APP_STATUS_RUNNING), ==, "running");
+    g_assert_cmpstr(app_status_to_string(APP_STATUS_STOPPING), ==, "stopping");
+    g_assert_cmpstr(app_status_to_string(APP_STATUS_FAILED), ==, "failed");
+}
+
+static void test_failure_reason_from_result(void)
+{
+    g_assert_cmpint(app_failure_reason_from_result("exit-code"), ==, APP_FAILURE_EXIT_CODE);
+    g_assert_cmpint(app_failure_reason_from_result("signal"), ==, APP_FAILURE_SIGNAL);
+    g_assert_cmpint(app_failure_reason_from_result("core-dump"), ==, APP_FAILURE_CORE_DUMP);
+    g_assert_cmpint(app_failure_reason_from_result("timeout"), ==, APP_FAILURE_TIMEOUT);
+    g_assert_cmpint(app_failure_reason_from_result("watchdog"), ==, APP_FAILURE_WATCHDOG);
+    g_assert_cmpint(app_failure_reason_from_result("start-limit-hit"), ==,
+                    APP_FAILURE_START_LIMIT);
+    g_assert_cmpint(app_failure_reason_from_result("resources"), ==, APP_FAILURE_RESOURCES);
+    g_assert_cmpint(app_failure_reason_from_result("oom-kill"), ==, APP_FAILURE_OOM_KILL);
+    g_assert_cmpint(app_failure_reason_from_result("success"), ==, APP_FAILURE_UNKNOWN);
+    g_assert_cmpint(app_failure_reason_from_result(NULL), ==, APP_FAILURE_UNKNOWN);
+}
+
+static void test_failure_reason_from_job_result(void)
+{
+    g_assert_cmpint(app_failure_reason_from_job_result("done"), ==, APP_FAILURE_NONE);
+    g_assert_cmpint(app_failure_reason_from_job_result("timeout"), ==, APP_FAILURE_TIMEOUT);
+    g_assert_cmpint(app_failure_reason_from_job_result("dependency"), ==,
+                    APP_FAILURE_START_REQUEST);
+    g_assert_cmpint(app_failure_reason_from_job_result("canceled"), ==,
+                    APP_FAILURE_START_REQUEST);
+    g_assert_cmpint(app_failure_reason_from_job_result("failed"), ==, APP_FAILURE_START_REQUEST);
+}
+
+int main(int argc, char *argv[])
+{
+    g_test_init(&argc, &argv, NULL);
+
+    g_test_add_func("/app-state/unit-state-from-string", test_unit_state_from_string);
+    g_test_add_func("/app-state/transitions-start-pending", test_transitions_start_pending);
+    g_test_add_func("/app-state/start", test_start);
+    g_test_add_func("/app-state/failed-start", test_failed_start);
+    g_test_add_func("/app-state/start-condition-not-met", test_start_condition_not_met);
+    g_test_add_func("/app-state/flap", test_flap);
+    g_test_add_func("/app-state/stop", test_stop);
+    g_test_add_func("/app-state/restart-while-stopping", test_restart_while_stopping);
+    g_test_add_func("/app-state/stop-aborted", test_stop_aborted);
+    g_test_add_func("/app-state/reload-while-running", test_reload_while_running);
+    g_test_add_func("/app-state/unknown-state", test_unknown_state);
+    g_test_add_func("/app-state/status-to-string", test_status_to_string);
+    g_test_add_func("/app-state/failure-reason-from-result", test_failure_reason_from_result);
+    g_test_add_func("/app-state/failure-reason-from-job-result",
+                    test_failure_reason_from_job_result);
+
+    return g_test_run();
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include <string.h>
+
+#include "metrics.h"
+
+static gint collector_calls;
+
+static void collect_cb(GPtrArray *metrics, gpointer user_data)
+{
+    const gchar *peer = user_data;
+    g_autofree gchar *label = metrics_format_label("peer", peer);
+
+    collector_calls++;
+    metrics_collected_add(metrics, METRIC_TYPE_GAUGE, "test_queue_depth", label,
+                          "Queue depth", 3);
+    metrics_collected_add(metrics, METRIC_TYPE_COUNTER, "test_dropped", label,
+                          "Dropped", 7);
+}
+
+static void test_format_label(void)
+{
+    g_autofree gchar *plain = metrics_format_label("peer", "unix:");
+    g_autofree gchar *escaped = metrics_format_label("peer", "a\"b\\c\nd");
+
+    g_assert_cmpstr(plain, ==, "peer=\"unix:\"");
+    g_assert_cmpstr(escaped, ==, "peer=\"a\\\"b\\\\c\\nd\"");
+}
+
+static void count_cb(Metric *metric, gpointer user_data)
+{
+    if (g_str_has_prefix(metric_get_name(metric), "test_"))
+        (*(gint *) user_data)++;
+}
+
+/*
+ * Collected metrics are enumerated along with the registered ones, only
+ * as long as their collector is there.
+ */
+static void test_collector(void)
+{
+    Metric *registered = metrics_gauge("test_registered", NULL, "Registered");
+    gint count = 0;
+
+    metric_set(registered, 1);
+    metrics_add_collector(collect_cb, "ipv4:127.0.0.1:1234");
+
+    metrics_foreach(count_cb, &count);
+    g_assert_cmpint(count, ==, 3);
+    g_assert_cmpint(collector_calls, ==, 1);
+
+    g_autofree gchar *text = metrics_to_openmetrics();
+    g_assert_nonnull(strstr(text, "# TYPE test_queue_depth gauge\n"
+                                  "# HELP test_queue_depth Queue depth\n"
+                                  "test_queue_depth{peer=\"ipv4:127.0.0.1:1234\"} 3\n"));
+    g_assert_nonnull(strstr(text, "test_dropped_total{peer=\"ipv4:127.0.0.1:1234\"} 7\n"));
+    g_assert_nonnull(strstr(text, "test_registered 1\n"));
+    g_assert_true(g_str_has_suffix(text, "# EOF\n"));
+
+    metrics_remove_collector(collect_cb, "ipv4:127.0.0.1:1234");
+    count = 0;
+    metrics_foreach(count_cb, &count);
+    g_assert_cmpint(count, ==, 1);
+    g_assert_cmpint(collector_calls, ==, 2);
+}
+
+int main(int argc, char *argv[])
+{
+    g_test_init(&argc, &argv, NULL);
+
+    g_test_add_func("/metrics/format-label", test_format_label);
+    g_test_add_func("/metrics/collector", test_collector);
+
+    return g_test_run();
+}
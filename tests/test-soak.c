@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include <malloc.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "fake-systemd.h"
+#include "systemd1_client.h"
+#include "systemd_manager.h"
+
+/*
+ * Start and stop an application over and over, checking that following its
+ * unit doesn't leak: the memory used and the number of live objects must be
+ * the same after the last cycle as after warming up.
+ */
+#define SOAK_CYCLES 100000
+#define SOAK_WARMUP 1000
+
+// Leaking a single Systemd1Unit per cycle would exceed both by far
+#define SOAK_MAX_RSS_GROWTH (4 * 1024 * 1024)
+#define SOAK_MAX_HEAP_GROWTH (256 * 1024)
+
+static const gchar *app_ids[] = { "soak", NULL };
+
+/*
+ * Live object counters: the test is linked with --wrap for the functions
+ * creating and destroying the objects following a unit.
+ */
+static gint live_units;
+static gint live_subscriptions;
+
+Systemd1Unit *__real_systemd1_unit_new(GDBusConnection *conn,
+                                       const gchar *bus_name,
+                                       const gchar *object_path,
+                                       Systemd1UnitChangedFunc callback,
+                                       gpointer user_data,
+                                       GError **error);
+void __real_systemd1_unit_free(Systemd1Unit *unit);
+guint __real_g_dbus_connection_signal_subscribe(GDBusConnection *connection,
+                                                const gchar *sender,
+                                                const gchar *interface_name,
+                                                const gchar *member,
+                                                const gchar *object_path,
+                                                const gchar *arg0,
+                                                GDBusSignalFlags flags,
+                                                GDBusSignalCallback callback,
+                                                gpointer user_data,
+                                                GDestroyNotify user_data_free_func);
+void __real_g_dbus_connection_signal_unsubscribe(GDBusConnection *connection,
+                                                 guint subscription_id);
+
+Systemd1Unit *__wrap_systemd1_unit_new(GDBusConnection *conn,
+                                       const gchar *bus_name,
+                                       const gchar *object_path,
+                                       Systemd1UnitChangedFunc callback,
+                                       gpointer user_data,
+                                       GError **error)
+{
+    Systemd1Unit *unit = __real_systemd1_unit_new(conn, bus_name, object_path,
+                                                  callback, user_data, error);
+
+    if (unit)
+        g_atomic_int_inc(&live_units);
+
+    return unit;
+}
+
+void __wrap_systemd1_unit_free(Systemd1Unit *unit)
+{
+    if (unit)
+        g_atomic_int_add(&live_units, -1);
+
+    __real_systemd1_unit_free(unit);
+}
+
+guint __wrap_g_dbus_connection_signal_subscribe(GDBusConnection *connection,
+                                                const gchar *sender,
+                                                const gchar *interface_name,
+                                                const gchar *member,
+                                                const gchar *object_path,
+                                                const gchar *arg0,
+                                                GDBusSignalFlags flags,
+                                                GDBusSignalCallback callback,
+                                                gpointer user_data,
+                                                GDestroyNotify user_data_free_func)
+{
+    g_atomic_int_inc(&live_subscriptions);
+
+    return __real_g_dbus_connection_signal_subscribe(connection, sender, interface_name,
+                                                     member, object_path, arg0, flags,
+                                                     callback, user_data,
+                                                     user_data_free_func);
+}
+
+void __wrap_g_dbus_connection_signal_unsubscribe(GDBusConnection *connection,
+                                                 guint subscription_id)
+{
+    g_atomic_int_add(&live_subscriptions, -1);
+
+    __real_g_dbus_connection_signal_unsubscribe(connection, subscription_id);
+}
+
+typedef struct {
+    gsize rss;
+    gsize heap;
+    gint units;
+    gint subscriptions;
+} Usage;
+
+static void get_usage(Usage *usage)
+{
+    FILE *statm = fopen("/proc/self/statm", "r");
+    unsigned long size, resident;
+
+    g_assert_nonnull(statm);
+    g_assert_cmpint(fscanf(statm, "%lu %lu", &size, &resident), ==, 2);
+    fclose(statm);
+    usage->rss = resident * sysconf(_SC_PAGESIZE);
+
+    // Give the unused memory held by the allocator back first
+    malloc_trim(0);
+    usage->heap = mallinfo2().uordblks;
+
+    usage->units = g_atomic_int_get(&live_units);
+    usage->subscriptions = g_atomic_int_get(&live_subscriptions);
+}
+
+static void wait_for_status(AppInfo *app_info, AppStatus status)
+{
+    while (app_info_get_status(app_info) != status)
+        g_main_context_iteration(NULL, TRUE);
+}
+
+static void test_start_stop_soak(void)
+{
+    FakeSystemd *fake = fake_systemd_new(app_ids);
+    SystemdManager *manager = systemd_manager_get_default();
+    AppInfo *app_info = systemd_manager_get_app_info(manager, "soak");
+    Usage warm, end;
+
+    g_assert_nonnull(app_info);
+
+    for (guint i = 0; i < SOAK_CYCLES; i++) {
+        if (i == SOAK_WARMUP)
+            get_usage(&warm);
+
+        g_assert_true(systemd_manager_start_app(manager, app_info));
+        g_assert_nonnull(app_info_get_runtime_data(app_info));
+        wait_for_status(app_info, APP_STATUS_RUNNING);
+
+        fake_systemd_stop(fake, "soak");
+        wait_for_status(app_info, APP_STATUS_INACTIVE);
+
+        // The unit is no longer followed once inactive
+        g_assert_null(app_info_get_runtime_data(app_info));
+        g_assert_cmpint(g_atomic_int_get(&live_units), ==, 0);
+    }
+
+    // Let GDBus finish with the last messages
+    while (g_main_context_iteration(NULL, FALSE));
+    get_usage(&end);
+
+    g_assert_cmpuint(fake_systemd_get_start_count(fake), ==, SOAK_CYCLES);
+
+    g_test_message("RSS %zu -> %zu KiB, heap %zu -> %zu KiB, %d -> %d signal subscriptions",
+                   warm.rss / 1024, end.rss / 1024, warm.heap / 1024, end.heap / 1024,
+                   warm.subscriptions, end.subscriptions);
+    g_assert_cmpuint(end.rss, <=, warm.rss + SOAK_MAX_RSS_GROWTH);
+    g_assert_cmpuint(end.heap, <=, warm.heap + SOAK_MAX_HEAP_GROWTH);
+    g_assert_cmpint(warm.units, ==, 0);
+    g_assert_cmpint(end.units, ==, 0);
+    g_assert_cmpint(end.subscriptions, ==, warm.subscriptions);
+
+    g_object_unref(manager);
+    fake_systemd_free(fake);
+}
+
+int main(int argc, char *argv[])
+{
+    g_test_init(&argc, &argv, NULL);
+    g_log_set_debug_enabled(FALSE);
+
+    g_test_add_func("/soak/start-stop", test_start_stop_soak);
+
+    return g_test_run();
+}
@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+#include "fake-systemd.h"
+#include "systemd_manager.h"
+
+static const gchar *app_ids[] = { "held", "dup", "flaky", "unmet", NULL };
+
+// A second unit for the "dup" application, ignored when listing them
+static const gchar *extra_files[] = { "agl-app-web@dup.service", NULL };
+
+static FakeSystemd *fake;
+
+typedef struct {
+    gchar *app_id;
+    AppStatus status;
+    AppFailureReason reason;
+} Notification;
+
+static void notification_free(gpointer data)
+{
+    Notification *notification = data;
+
+    g_free(notification->app_id);
+    g_free(notification);
+}
+
+static void status_changed_cb(GPtrArray *notifications, const gchar *app_id,
+                              gint status, gint reason, gint notify,
+                              gpointer caller)
+{
+    Notification *notification = g_new0(Notification, 1);
+
+    notification->app_id = g_strdup(app_id);
+    notification->status = status;
+    notification->reason = reason;
+    g_ptr_array_add(notifications, notification);
+}
+
+static void wait_for_status(AppInfo *app_info, AppStatus status)
+{
+    while (app_info_get_status(app_info) != status)
+        g_main_context_iteration(NULL, TRUE);
+}
+
+static void wait_for_notifications(GPtrArray *notifications, guint count)
+{
+    while (notifications->len < count)
+        g_main_context_iteration(NULL, TRUE);
+}
+
+/*
+ * Get the manager, which warns about the duplicate units when listing them.
+ */
+static SystemdManager *get_manager(void)
+{
+    g_test_expect_message(NULL, G_LOG_LEVEL_WARNING, "Ignoring duplicate application 'dup'");
+    SystemdManager *manager = systemd_manager_get_default();
+    g_test_assert_expected_messages();
+
+    return manager;
+}
+
+/*
+ * Hand the state of `manager` over to a new manager, as across restarts.
+ */
+static SystemdManager *restart_manager(SystemdManager *manager)
+{
+    GVariant *state = g_variant_ref_sink(systemd_manager_save_state(manager));
+    gboolean restored;
+
+    g_object_unref(manager);
+    manager = systemd_manager_get_default_with_state(state, &restored);
+    g_assert_true(restored);
+    g_variant_unref(state);
+
+    return manager;
+}
+
+/*
+ * A status change still held back by the coalescing window when saving
+ * gets notified by the restored manager, which keeps following the unit.
+ */
+static void test_restore_held_back_status(void)
+{
+    SystemdManager *manager = get_manager();
+    GPtrArray *notifications = g_ptr_array_new_with_free_func(notification_free);
+    AppInfo *app_info;
+
+    systemd_manager_set_coalesce_window(manager, 60000);
+    app_info = systemd_manager_get_app_info(manager, "held");
+    g_assert_true(systemd_manager_start_app(manager, app_info));
+    wait_for_status(app_info, APP_STATUS_RUNNING);
+
+    manager = restart_manager(manager);
+    systemd_manager_connect_status_callback(manager, G_CALLBACK(status_changed_cb),
+                                            notifications);
+    app_info = systemd_manager_get_app_info(manager, "held");
+    g_assert_cmpint(app_info_get_status(app_info), ==, APP_STATUS_RUNNING);
+    g_assert_nonnull(app_info_get_runtime_data(app_info));
+
+    while (g_main_context_iteration(NULL, FALSE));
+    g_assert_cmpuint(notifications->len, ==, 1);
+    g_assert_cmpstr(((Notification *)notifications->pdata[0])->app_id, ==, "held");
+    g_assert_cmpint(((Notification *)notifications->pdata[0])->status, ==, APP_STATUS_RUNNING);
+
+    fake_systemd_stop(fake, "held");
+    wait_for_status(app_info, APP_STATUS_INACTIVE);
+    g_assert_cmpuint(notifications->len, ==, 3);
+    g_assert_cmpint(((Notification *)notifications->pdata[2])->status, ==, APP_STATUS_INACTIVE);
+
+    g_object_unref(manager);
+    g_ptr_array_unref(notifications);
+}
+
+/*
+ * The first status change is notified right away and the ones following
+ * it within the coalescing window at its end, where failing again for
+ * another reason isn't mistaken for no change.
+ */
+static void test_coalesce_status(void)
+{
+    SystemdManager *manager = get_manager();
+    GPtrArray *notifications = g_ptr_array_new_with_free_func(notification_free);
+    AppInfo *app_info;
+    Notification *notification;
+
+    systemd_manager_set_coalesce_window(manager, 1000);
+    systemd_manager_connect_status_callback(manager, G_CALLBACK(status_changed_cb),
+                                            notifications);
+    app_info = systemd_manager_get_app_info(manager, "flaky");
+
+    fake_systemd_set_behavior(fake, "flaky", FAKE_UNIT_FAIL);
+    g_assert_true(systemd_manager_start_app(manager, app_info));
+    wait_for_status(app_info, APP_STATUS_FAILED);
+    g_assert_cmpuint(notifications->len, ==, 1);
+    g_assert_cmpint(((Notification *)notifications->pdata[0])->status, ==, APP_STATUS_STARTING);
+
+    wait_for_notifications(notifications, 2);
+    notification = notifications->pdata[1];
+    g_assert_cmpint(notification->status, ==, APP_STATUS_FAILED);
+    g_assert_cmpint(notification->reason, ==, APP_FAILURE_EXIT_CODE);
+
+    // Still within the window following the failure
+    fake_systemd_set_behavior(fake, "flaky", FAKE_UNIT_CRASH);
+    g_assert_true(systemd_manager_start_app(manager, app_info));
+    while (app_info_get_failure_reason(app_info) != APP_FAILURE_SIGNAL)
+        g_main_context_iteration(NULL, TRUE);
+    g_assert_cmpuint(notifications->len, ==, 2);
+
+    wait_for_notifications(notifications, 3);
+    notification = notifications->pdata[2];
+    g_assert_cmpint(notification->status, ==, APP_STATUS_FAILED);
+    g_assert_cmpint(notification->reason, ==, APP_FAILURE_SIGNAL);
+    g_assert_cmpuint(systemd_manager_get_suppressed_events(manager), ==, 1);
+
+    g_object_unref(manager);
+    g_ptr_array_unref(notifications);
+}
+
+/*
+ * A start whose job gets removed while the unit stays "inactive" doesn't
+ * leave the application starting: it is back to inactive if the job was
+ * done anyway, e.g. with a condition not met, and failed otherwise.
+ */
+static void test_start_job_removed(void)
+{
+    SystemdManager *manager = get_manager();
+    GPtrArray *notifications = g_ptr_array_new_with_free_func(notification_free);
+    AppInfo *app_info;
+    Notification *notification;
+
+    systemd_manager_connect_status_callback(manager, G_CALLBACK(status_changed_cb),
+                                            notifications);
+    app_info = systemd_manager_get_app_info(manager, "unmet");
+
+    fake_systemd_set_behavior(fake, "unmet", FAKE_UNIT_UNMET);
+    g_assert_true(systemd_manager_start_app(manager, app_info));
+    wait_for_status(app_info, APP_STATUS_INACTIVE);
+    g_assert_null(app_info_get_runtime_data(app_info));
+    g_assert_cmpuint(notifications->len, ==, 2);
+    g_assert_cmpint(((Notification *)notifications->pdata[0])->status, ==, APP_STATUS_STARTING);
+    g_assert_cmpint(((Notification *)notifications->pdata[1])->status, ==, APP_STATUS_INACTIVE);
+
+    fake_systemd_set_behavior(fake, "unmet", FAKE_UNIT_DEPENDENCY);
+    g_assert_true(systemd_manager_start_app(manager, app_info));
+    wait_for_status(app_info, APP_STATUS_FAILED);
+    g_assert_null(app_info_get_runtime_data(app_info));
+    g_assert_cmpuint(notifications->len, ==, 4);
+    notification = notifications->pdata[3];
+    g_assert_cmpint(notification->status, ==, APP_STATUS_FAILED);
+    g_assert_cmpint(notification->reason, ==, APP_FAILURE_START_REQUEST);
+
+    g_object_unref(manager);
+    g_ptr_array_unref(notifications);
+}
+
+/*
+ * Duplicate units don't make the restored list look out of date, which
+ * would rebuild it by querying every unit.
+ */
+static void test_reconcile_duplicate_units(void)
+{
+    SystemdManager *manager = get_manager();
+    guint descriptions;
+
+    g_assert_cmpuint(g_list_length(systemd_manager_get_app_list(manager)), ==, 4);
+
+    manager = restart_manager(manager);
+    descriptions = fake_systemd_get_description_count(fake);
+    while (g_main_context_iteration(NULL, FALSE));
+    g_assert_cmpuint(fake_systemd_get_description_count(fake), ==, descriptions);
+
+    g_object_unref(manager);
+}
+
+int main(int argc, char *argv[])
+{
+    int ret;
+
+    g_test_init(&argc, &argv, NULL);
+    g_log_set_debug_enabled(FALSE);
+
+    // Shared by all tests, the system bus connection being a singleton
+    fake = fake_systemd_new_full(app_ids, extra_files);
+
+    g_test_add_func("/systemd-manager/restore-held-back-status", test_restore_held_back_status);
+    g_test_add_func("/systemd-manager/coalesce-status", test_coalesce_status);
+    g_test_add_func("/systemd-manager/start-job-removed", test_start_job_removed);
+    g_test_add_func("/systemd-manager/reconcile-duplicate-units", test_reconcile_duplicate_units);
+
+    ret = g_test_run();
+    fake_systemd_free(fake);
+
+    return ret;
+}
@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// Heap allocations per RPC, counted by interposing malloc and friends. The
+// service runs in-process against the fake systemd of the tests and the
+// counts are process-wide: they include the raw client calls, the gRPC
+// machinery and, for StartApplication, the D-Bus round trip to the fake
+// systemd, which are the same from one build of the service to the other.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <malloc.h>
+
+#include <grpcpp/generic/generic_stub.h>
+
+#include "AppLauncherImpl.h"
+#include "fake-systemd.h"
+
+using automotivegradelinux::APP_STATE_RUNNING;
+using automotivegradelinux::FAILURE_REASON_NONE;
+
+static const int CALLS = 2000;
+static const int WARMUP = 200;
+
+static std::atomic<bool> counting { false };
+static std::atomic<uint64_t> allocations { 0 };
+static std::atomic<uint64_t> allocated_bytes { 0 };
+
+static inline void count(size_t size)
+{
+	if (counting.load(std::memory_order_relaxed)) {
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+	}
+}
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size)
+{
+	count(size);
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size)
+{
+	count(n * size);
+	return __libc_calloc(n, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	count(size);
+	return __libc_realloc(ptr, size);
+}
+
+void *memalign(size_t alignment, size_t size)
+{
+	count(size);
+	return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+	count(size);
+	return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+	count(size);
+	*ptr = __libc_memalign(alignment, size);
+	return *ptr ? 0 : ENOMEM;
+}
+
+}
+
+static const char *SERVICE = "/automotivegradelinux.AppLauncher/";
+
+template <class Message>
+static grpc::ByteBuffer serialize(const Message &message)
+{
+	std::string data = message.SerializeAsString();
+	grpc::Slice slice(data);
+
+	return grpc::ByteBuffer(&slice, 1);
+}
+
+static void unary_call(grpc::GenericStub &stub, const char *method,
+		       const grpc::ByteBuffer &request)
+{
+	std::mutex mutex;
+	std::condition_variable cond;
+	bool done = false;
+	grpc::ClientContext context;
+	grpc::ByteBuffer response;
+
+	stub.UnaryCall(&context, std::string(SERVICE) + method, grpc::StubOptions(),
+		       &request, &response,
+		       [&](grpc::Status status) {
+			       const std::lock_guard<std::mutex> lock(mutex);
+			       done = true;
+			       cond.notify_one();
+		       });
+
+	std::unique_lock<std::mutex> lock(mutex);
+	cond.wait(lock, [&] { return done; });
+}
+
+// Raw GetStatusEvents stream, counting the events received
+class Subscriber : public grpc::ClientBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>
+{
+public:
+	explicit Subscriber(grpc::GenericStub *stub) {
+		grpc::Slice slice("", 0);
+		m_request = grpc::ByteBuffer(&slice, 1);
+
+		stub->PrepareBidiStreamingCall(&m_context, std::string(SERVICE) + "GetStatusEvents",
+					       grpc::StubOptions(), this);
+		StartWrite(&m_request);
+		StartWritesDone();
+		StartRead(&m_event);
+		StartCall();
+	}
+
+	void OnReadDone(bool ok) override {
+		if (!ok)
+			return;
+
+		{
+			const std::lock_guard<std::mutex> lock(m_mutex);
+			m_received++;
+		}
+		m_cond.notify_one();
+		StartRead(&m_event);
+	}
+
+	void OnDone(const grpc::Status &status) override {
+		const std::lock_guard<std::mutex> lock(m_mutex);
+		m_done = true;
+		m_cond.notify_one();
+	}
+
+	void WaitReceived(uint64_t received) {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cond.wait(lock, [&] { return m_received >= received; });
+	}
+
+	void WaitDone() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cond.wait(lock, [this] { return m_done; });
+	}
+
+private:
+	grpc::ClientContext m_context;
+	grpc::ByteBuffer m_request;
+	grpc::ByteBuffer m_event;
+	std::mutex m_mutex;
+	std::condition_variable m_cond;
+	uint64_t m_received = 0;
+	bool m_done = false;
+};
+
+static void measure(const char *name, const std::function<void()> &call)
+{
+	for (int i = 0; i < WARMUP; i++)
+		call();
+
+	allocations = 0;
+	allocated_bytes = 0;
+	counting = true;
+	for (int i = 0; i < CALLS; i++)
+		call();
+	counting = false;
+
+	printf("%-32s %12.1f %12.0f\n", name, (double) allocations / CALLS,
+	       (double) allocated_bytes / CALLS);
+}
+
+int main(int argc, char *argv[])
+{
+	const gchar *app_ids[] = { "bench", "bench2", "bench3", "bench4", "bench5", NULL };
+
+	g_log_set_debug_enabled(FALSE);
+
+	FakeSystemd *fake = fake_systemd_new(app_ids);
+	SystemdManager *manager = systemd_manager_get_default();
+	AppLauncherImpl service(manager);
+
+	int port = 0;
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+	builder.RegisterService(&service);
+	std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+
+	// StartApplication runs from the main loop
+	GMainLoop *loop = g_main_loop_new(NULL, FALSE);
+	std::thread loop_thread(g_main_loop_run, loop);
+
+	auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port),
+					   grpc::InsecureChannelCredentials());
+	grpc::GenericStub stub(channel);
+
+	automotivegradelinux::ListRequest list_request;
+	automotivegradelinux::StartRequest start_request;
+	automotivegradelinux::StartRequest unknown_request;
+	start_request.set_id("bench");
+	unknown_request.set_id("unknown");
+	grpc::ByteBuffer list_buffer = serialize(list_request);
+	grpc::ByteBuffer start_buffer = serialize(start_request);
+	grpc::ByteBuffer unknown_buffer = serialize(unknown_request);
+
+	printf("%d calls, process-wide\n", CALLS);
+	printf("%-32s %12s %12s\n", "", "allocs/call", "bytes/call");
+
+	measure("ListApplications", [&]() {
+		unary_call(stub, "ListApplications", list_buffer);
+	});
+	measure("StartApplication, unknown app", [&]() {
+		unary_call(stub, "StartApplication", unknown_buffer);
+	});
+	measure("StartApplication, running app", [&]() {
+		unary_call(stub, "StartApplication", start_buffer);
+	});
+
+	Subscriber subscriber(&stub);
+	while (service.GetSubscriberStats().empty())
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	uint64_t sent = 0;
+	measure("SendStatus, 1 subscriber", [&]() {
+		service.SendStatus("bench", APP_STATE_RUNNING, FAILURE_REASON_NONE);
+		subscriber.WaitReceived(++sent);
+	});
+
+	service.Shutdown();
+	subscriber.WaitDone();
+	g_main_loop_quit(loop);
+	loop_thread.join();
+	g_main_loop_unref(loop);
+
+	server->Shutdown();
+	g_object_unref(manager);
+	fake_systemd_free(fake);
+
+	return 0;
+}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// Status event fan-out: with 1 to 1000 GetStatusEvents subscribers, time
+// SendStatus queueing an event for all of them, and the event reaching the
+// last one. The service runs in-process against the fake systemd of the
+// tests, the subscribers are raw streams on a single channel so that
+// receiving costs no parsing.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/generic/generic_stub.h>
+
+#include "AppLauncherImpl.h"
+#include "fake-systemd.h"
+
+using automotivegradelinux::APP_STATE_INACTIVE;
+using automotivegradelinux::APP_STATE_RUNNING;
+using automotivegradelinux::FAILURE_REASON_NONE;
+
+typedef std::chrono::steady_clock Clock;
+
+static const int EVENTS = 200;
+
+// Events received by all the subscribers
+static std::mutex received_mutex;
+static std::condition_variable received_cond;
+static uint64_t received;
+
+class Subscriber : public grpc::ClientBidiReactor<grpc::ByteBuffer, grpc::ByteBuffer>
+{
+public:
+	explicit Subscriber(grpc::GenericStub *stub) {
+		// An empty StatusRequest, only subscribing to new events
+		grpc::Slice slice("", 0);
+		m_request = grpc::ByteBuffer(&slice, 1);
+
+		stub->PrepareBidiStreamingCall(&m_context,
+					       "/automotivegradelinux.AppLauncher/GetStatusEvents",
+					       grpc::StubOptions(), this);
+		StartWrite(&m_request);
+		StartWritesDone();
+		StartRead(&m_event);
+		StartCall();
+	}
+
+	void OnReadDone(bool ok) override {
+		if (!ok)
+			return;
+
+		{
+			const std::lock_guard<std::mutex> lock(received_mutex);
+			received++;
+		}
+		received_cond.notify_one();
+		StartRead(&m_event);
+	}
+
+	void OnDone(const grpc::Status &status) override {
+		const std::lock_guard<std::mutex> lock(m_mutex);
+		m_done = true;
+		m_cond.notify_one();
+	}
+
+	void WaitDone() {
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cond.wait(lock, [this] { return m_done; });
+	}
+
+private:
+	grpc::ClientContext m_context;
+	grpc::ByteBuffer m_request;
+	grpc::ByteBuffer m_event;
+	std::mutex m_mutex;
+	std::condition_variable m_cond;
+	bool m_done = false;
+};
+
+static double percentile(std::vector<double> &samples, double p)
+{
+	std::sort(samples.begin(), samples.end());
+	return samples[std::min<size_t>(samples.size() * p, samples.size() - 1)];
+}
+
+int main(int argc, char *argv[])
+{
+	const gchar *app_ids[] = { "bench", NULL };
+	int max_subscribers = argc > 1 ? atoi(argv[1]) : 1000;
+
+	g_log_set_debug_enabled(FALSE);
+
+	FakeSystemd *fake = fake_systemd_new(app_ids);
+	SystemdManager *manager = systemd_manager_get_default();
+	AppLauncherImpl service(manager, AppLauncherImpl::DEFAULT_QUEUE_SIZE,
+				OverflowPolicy::DropOldest, 0);
+
+	int port = 0;
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+	builder.RegisterService(&service);
+	std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+
+	auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port),
+					   grpc::InsecureChannelCredentials());
+	grpc::GenericStub stub(channel);
+
+	printf("%d events per run\n", EVENTS);
+	printf("%11s %12s %12s %12s %12s %15s\n", "subscribers", "queue p50", "queue p99",
+	       "deliver p50", "deliver p99", "per subscriber");
+
+	std::vector<std::unique_ptr<Subscriber> > subscribers;
+	for (int count = 1; count <= max_subscribers; count *= 10) {
+		while ((int) subscribers.size() < count)
+			subscribers.push_back(std::make_unique<Subscriber>(&stub));
+		while ((int) service.GetSubscriberStats().size() < count)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		std::vector<double> queued, delivered;
+		for (int i = 0; i < EVENTS; i++) {
+			uint64_t expected;
+			{
+				const std::lock_guard<std::mutex> lock(received_mutex);
+				expected = received + count;
+			}
+
+			auto start = Clock::now();
+			service.SendStatus("bench", i % 2 ? APP_STATE_INACTIVE : APP_STATE_RUNNING,
+					   FAILURE_REASON_NONE);
+			auto sent = Clock::now();
+
+			std::unique_lock<std::mutex> lock(received_mutex);
+			received_cond.wait(lock, [&] { return received >= expected; });
+			auto end = Clock::now();
+
+			queued.push_back(std::chrono::duration<double, std::micro>(sent - start).count());
+			delivered.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+		}
+
+		double deliver_p50 = percentile(delivered, 0.5);
+		printf("%11d %10.1fus %10.1fus %10.1fus %10.1fus %13.2fus\n", count,
+		       percentile(queued, 0.5), percentile(queued, 0.99),
+		       deliver_p50, percentile(delivered, 0.99), deliver_p50 / count);
+	}
+
+	service.Shutdown();
+	for (auto &subscriber : subscribers)
+		subscriber->WaitDone();
+	server->Shutdown();
+
+	g_object_unref(manager);
+	fake_systemd_free(fake);
+
+	return 0;
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// ListApplications cost: latency of back-to-back calls for catalogs of 10
+// to 1000 applications. The service runs in-process against the fake
+// systemd of the tests, each catalog size in its own process as systemd
+// managers are singletons. The calls are raw so that the client does not
+// spend time parsing the replies.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <grpcpp/generic/generic_stub.h>
+
+#include "AppLauncherImpl.h"
+#include "fake-systemd.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int CALLS = 2000;
+
+static grpc::Status list_applications(grpc::GenericStub &stub,
+				      const grpc::ByteBuffer &request,
+				      grpc::ByteBuffer *response)
+{
+	std::mutex mutex;
+	std::condition_variable cond;
+	bool done = false;
+	grpc::Status result;
+	grpc::ClientContext context;
+
+	stub.UnaryCall(&context, "/automotivegradelinux.AppLauncher/ListApplications",
+		       grpc::StubOptions(), &request, response,
+		       [&](grpc::Status status) {
+			       const std::lock_guard<std::mutex> lock(mutex);
+			       result = status;
+			       done = true;
+			       cond.notify_one();
+		       });
+
+	std::unique_lock<std::mutex> lock(mutex);
+	cond.wait(lock, [&] { return done; });
+
+	return result;
+}
+
+static void run(int apps)
+{
+	std::vector<std::string> ids;
+	std::vector<const gchar *> app_ids;
+	for (int i = 0; i < apps; i++)
+		ids.push_back("app" + std::to_string(i));
+	for (auto &id : ids)
+		app_ids.push_back(id.c_str());
+	app_ids.push_back(NULL);
+
+	g_log_set_debug_enabled(FALSE);
+
+	FakeSystemd *fake = fake_systemd_new(app_ids.data());
+	SystemdManager *manager = systemd_manager_get_default();
+	AppLauncherImpl service(manager);
+
+	int port = 0;
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+	builder.RegisterService(&service);
+	std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+
+	auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port),
+					   grpc::InsecureChannelCredentials());
+	grpc::GenericStub stub(channel);
+
+	// An empty ListRequest, listing everything
+	grpc::Slice slice("", 0);
+	grpc::ByteBuffer request(&slice, 1);
+	grpc::ByteBuffer response;
+
+	std::vector<double> samples;
+	auto start = Clock::now();
+	for (int i = 0; i < CALLS; i++) {
+		auto call_start = Clock::now();
+		grpc::Status status = list_applications(stub, request, &response);
+		auto call_end = Clock::now();
+
+		if (!status.ok()) {
+			fprintf(stderr, "ListApplications failed: %s\n", status.error_message().c_str());
+			exit(1);
+		}
+		samples.push_back(std::chrono::duration<double, std::micro>(call_end - call_start).count());
+	}
+	double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+	std::sort(samples.begin(), samples.end());
+	printf("%6d %10zu %10.1fus %10.1fus %10.0f\n", apps, response.Length(),
+	       samples[samples.size() / 2], samples[samples.size() * 99 / 100], CALLS / elapsed);
+
+	server->Shutdown();
+	g_object_unref(manager);
+	fake_systemd_free(fake);
+}
+
+int main(int argc, char *argv[])
+{
+	printf("%d calls per catalog size\n", CALLS);
+	printf("%6s %10s %12s %12s %10s\n", "apps", "bytes", "p50", "p99", "calls/s");
+	fflush(stdout);
+
+	for (int apps = 10; apps <= 1000; apps *= 10) {
+		pid_t pid = fork();
+
+		if (pid == 0) {
+			run(apps);
+			fflush(stdout);
+			_exit(0);
+		}
+
+		int status;
+		if (pid < 0 || waitpid(pid, &status, 0) < 0 ||
+		    !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// Subscriber snapshot under churn: reader threads take the current
+// snapshot and walk it, as the status event dispatch does, while a writer
+// keeps publishing modified copies, as subscribing and unsubscribing do.
+// Compares RcuPointer with std::atomic_load/std::atomic_store on a
+// shared_ptr.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "RcuPointer.h"
+
+typedef std::chrono::steady_clock Clock;
+
+// Stands for the ClientIndex, a list of references to the subscribers
+typedef std::vector<std::shared_ptr<int> > Index;
+
+static const int SUBSCRIBERS = 100;
+static const auto DURATION = std::chrono::milliseconds(500);
+
+struct Result {
+	uint64_t reads;
+	uint64_t publishes;
+	uint64_t read_p50_ns;
+	uint64_t read_p99_ns;
+	uint64_t read_max_ns;
+};
+
+static std::unique_ptr<Index> make_index()
+{
+	auto index = std::make_unique<Index>();
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		index->push_back(std::make_shared<int>(i));
+
+	return index;
+}
+
+// Replace one subscriber, as an unsubscribe followed by a subscribe
+static std::unique_ptr<Index> churn(const Index &current, int n)
+{
+	auto index = std::make_unique<Index>(current);
+	(*index)[n % SUBSCRIBERS] = std::make_shared<int>(n);
+
+	return index;
+}
+
+template <class Snapshot>
+static Result run(Snapshot &snapshot, int readers, bool with_writer)
+{
+	std::atomic<bool> stop { false };
+	std::atomic<uint64_t> reads { 0 };
+	std::atomic<uint64_t> publishes { 0 };
+	std::vector<std::vector<uint32_t> > latencies(readers);
+	std::vector<std::thread> threads;
+
+	for (int r = 0; r < readers; r++) {
+		threads.emplace_back([&, r]() {
+			auto &samples = latencies[r];
+			uint64_t n = 0;
+			long sum = 0;
+
+			while (!stop.load(std::memory_order_relaxed)) {
+				auto start = Clock::now();
+				sum += snapshot.Walk();
+				auto end = Clock::now();
+
+				// Every read is timed, keep one sample out of 16
+				if ((n++ & 15) == 0)
+					samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+			}
+			reads += n;
+			if (sum == 42)
+				printf("\n");
+		});
+	}
+
+	if (with_writer) {
+		threads.emplace_back([&]() {
+			int n = 0;
+			while (!stop.load(std::memory_order_relaxed)) {
+				snapshot.Churn(n++);
+				publishes++;
+			}
+		});
+	}
+
+	auto start = Clock::now();
+	std::this_thread::sleep_for(DURATION);
+	stop = true;
+	for (auto &t : threads)
+		t.join();
+	double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+	std::vector<uint32_t> all;
+	for (auto &samples : latencies)
+		all.insert(all.end(), samples.begin(), samples.end());
+	std::sort(all.begin(), all.end());
+
+	Result result;
+	result.reads = reads / elapsed;
+	result.publishes = publishes / elapsed;
+	result.read_p50_ns = all.empty() ? 0 : all[all.size() / 2];
+	result.read_p99_ns = all.empty() ? 0 : all[all.size() * 99 / 100];
+	result.read_max_ns = all.empty() ? 0 : all.back();
+
+	return result;
+}
+
+class SharedPtrSnapshot
+{
+public:
+	SharedPtrSnapshot() : m_index(make_index()) {}
+
+	long Walk() {
+		auto index = std::atomic_load(&m_index);
+		long sum = 0;
+		for (auto &s : *index)
+			sum += *s;
+		return sum;
+	}
+
+	void Churn(int n) {
+		auto index = churn(*std::atomic_load(&m_index), n);
+		std::atomic_store(&m_index, std::shared_ptr<const Index>(std::move(index)));
+	}
+
+private:
+	std::shared_ptr<const Index> m_index;
+};
+
+class RcuSnapshot
+{
+public:
+	RcuSnapshot() : m_index(make_index()) {}
+
+	long Walk() {
+		auto index = m_index.Read();
+		long sum = 0;
+		for (auto &s : *index)
+			sum += *s;
+		return sum;
+	}
+
+	void Churn(int n) {
+		m_index.Publish(churn(m_index.Current(), n));
+	}
+
+private:
+	RcuPointer<Index> m_index;
+};
+
+int main(int argc, char *argv[])
+{
+	int max_readers = argc > 1 ? atoi(argv[1]) : 4;
+
+	printf("%d subscribers, %lld ms per run\n", SUBSCRIBERS, (long long) DURATION.count());
+	printf("%-10s %7s %6s %12s %10s %10s %10s %12s\n", "snapshot", "readers", "churn",
+	       "reads/s", "p50 ns", "p99 ns", "max ns", "publishes/s");
+
+	for (int readers = 1; readers <= max_readers; readers *= 2) {
+		for (bool with_writer : { false, true }) {
+			SharedPtrSnapshot shared;
+			RcuSnapshot rcu;
+			Result results[] = {
+				run(shared, readers, with_writer),
+				run(rcu, readers, with_writer),
+			};
+			const char *names[] = { "shared_ptr", "rcu" };
+
+			for (int i = 0; i < 2; i++) {
+				printf("%-10s %7d %6s %12llu %10llu %10llu %10llu %12llu\n", names[i], readers,
+				       with_writer ? "yes" : "no",
+				       (unsigned long long) results[i].reads,
+				       (unsigned long long) results[i].read_p50_ns,
+				       (unsigned long long) results[i].read_p99_ns,
+				       (unsigned long long) results[i].read_max_ns,
+				       (unsigned long long) results[i].publishes);
+			}
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+/*
+ * systemd's private socket vs the system bus: latency of connecting, of the
+ * calls the daemon makes to systemd, and of following a unit from StartUnit
+ * to its "active" PropertiesChanged signal. Runs the systemd1 client against
+ * the fake systemd of the tests, through a dbus-daemon on one side and its
+ * peer-to-peer server on the other.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fake-systemd.h"
+#include "systemd1_client.h"
+
+#define CONNECTIONS 200
+#define CALLS 5000
+#define CYCLES 1000
+
+#define UNIT "agl-app@bench.service"
+#define UNIT_PATH "/org/freedesktop/systemd1/unit/agl_2dapp_40bench_2eservice"
+
+typedef struct {
+    const gchar *name;
+    const gchar *address;
+    GDBusConnectionFlags flags;
+    // systemd's name on the bus, NULL on the private socket
+    const gchar *bus_name;
+} Transport;
+
+static int compare_samples(const void *a, const void *b)
+{
+    gint64 x = *(const gint64 *)a, y = *(const gint64 *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void print_samples(const gchar *transport, const gchar *name, gint64 *samples, guint count)
+{
+    qsort(samples, count, sizeof(*samples), compare_samples);
+    printf("%-8s %-24s %8" G_GINT64_FORMAT "us %8" G_GINT64_FORMAT "us\n", transport, name,
+           samples[count / 2], samples[count * 99 / 100]);
+}
+
+static GDBusConnection *transport_connect(const Transport *transport)
+{
+    GError *error = NULL;
+    GDBusConnection *conn =
+        g_dbus_connection_new_for_address_sync(transport->address, transport->flags,
+                                               NULL, NULL, &error);
+    if (!conn) {
+        g_critical("Failed to connect to %s: %s", transport->address, error->message);
+        exit(1);
+    }
+
+    return conn;
+}
+
+static void unit_changed_cb(Systemd1Unit *unit, gpointer user_data)
+{
+}
+
+static void wait_for_state(Systemd1Unit *unit, UnitState state)
+{
+    while (systemd1_unit_get_active_state(unit) != state)
+        g_main_context_iteration(NULL, TRUE);
+}
+
+static void run(FakeSystemd *fake, const Transport *transport)
+{
+    gint64 *samples = g_new(gint64, CALLS);
+    GError *error = NULL;
+
+    for (guint i = 0; i < CONNECTIONS; i++) {
+        gint64 start = g_get_monotonic_time();
+        GDBusConnection *conn = transport_connect(transport);
+        samples[i] = g_get_monotonic_time() - start;
+
+        g_dbus_connection_close_sync(conn, NULL, NULL);
+        g_object_unref(conn);
+    }
+    print_samples(transport->name, "connect", samples, CONNECTIONS);
+
+    GDBusConnection *conn = transport_connect(transport);
+
+    for (guint i = 0; i < CALLS; i++) {
+        gint64 start = g_get_monotonic_time();
+        GVariant *state = systemd1_get_property(conn, transport->bus_name, UNIT_PATH,
+                                                "org.freedesktop.systemd1.Unit", "ActiveState",
+                                                G_VARIANT_TYPE_STRING, &error);
+        samples[i] = g_get_monotonic_time() - start;
+
+        g_assert_no_error(error);
+        g_variant_unref(state);
+    }
+    print_samples(transport->name, "Get ActiveState", samples, CALLS);
+
+    Systemd1Unit *unit = systemd1_unit_new(conn, transport->bus_name, UNIT_PATH,
+                                           unit_changed_cb, NULL, &error);
+    g_assert_no_error(error);
+
+    gint64 *starts = g_new(gint64, CYCLES);
+    for (guint i = 0; i < CYCLES; i++) {
+        gint64 start = g_get_monotonic_time();
+        gboolean started = systemd1_manager_start_unit(conn, transport->bus_name, UNIT,
+                                                       "replace", NULL, &error);
+        starts[i] = g_get_monotonic_time() - start;
+
+        g_assert_no_error(error);
+        g_assert_true(started);
+        wait_for_state(unit, UNIT_STATE_ACTIVE);
+        samples[i] = g_get_monotonic_time() - start;
+
+        fake_systemd_stop(fake, "bench");
+        wait_for_state(unit, UNIT_STATE_INACTIVE);
+    }
+    print_samples(transport->name, "StartUnit", starts, CYCLES);
+    print_samples(transport->name, "StartUnit to active", samples, CYCLES);
+
+    systemd1_unit_free(unit);
+    g_dbus_connection_close_sync(conn, NULL, NULL);
+    g_object_unref(conn);
+    g_free(starts);
+    g_free(samples);
+}
+
+int main(int argc, char *argv[])
+{
+    const gchar *app_ids[] = { "bench", NULL };
+
+    g_log_set_debug_enabled(FALSE);
+
+    FakeSystemd *fake = fake_systemd_new(app_ids);
+    const Transport transports[] = {
+        {
+            "bus", g_getenv("DBUS_SYSTEM_BUS_ADDRESS"),
+            G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT |
+            G_DBUS_CONNECTION_FLAGS_MESSAGE_BUS_CONNECTION,
+            SYSTEMD1_BUS_NAME
+        },
+        {
+            "private", fake_systemd_get_private_address(fake),
+            G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT,
+            NULL
+        },
+    };
+
+    printf("%d connections, %d calls, %d start cycles per transport\n",
+           CONNECTIONS, CALLS, CYCLES);
+    printf("%-8s %-24s %10s %10s\n", "", "", "p50", "p99");
+
+    for (guint i = 0; i < G_N_ELEMENTS(transports); i++)
+        run(fake, &transports[i]);
+
+    fake_systemd_free(fake);
+
+    return 0;
+}
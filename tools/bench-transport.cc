@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: Apache-2.0
+/*
+ * Copyright (C) 2022 Konsulko Group
+ */
+
+// TCP vs unix socket: latency of ListApplications calls on an established
+// channel, and of connecting a new channel up to its first reply, which
+// includes the peer credential check on the unix socket. The service runs
+// in-process against the fake systemd of the tests, with a loopback TCP
+// port and a UnixListener served by a GLib main loop thread.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include <grpcpp/generic/generic_stub.h>
+
+#include "AppLauncherImpl.h"
+#include "UnixListener.h"
+#include "fake-systemd.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int CALLS = 5000;
+static const int CONNECTIONS = 500;
+
+static grpc::Status list_applications(grpc::GenericStub &stub)
+{
+	std::mutex mutex;
+	std::condition_variable cond;
+	bool done = false;
+	grpc::Status result;
+	grpc::ClientContext context;
+
+	// An empty ListRequest, listing everything
+	grpc::Slice slice("", 0);
+	grpc::ByteBuffer request(&slice, 1);
+	grpc::ByteBuffer response;
+
+	context.set_wait_for_ready(true);
+	stub.UnaryCall(&context, "/automotivegradelinux.AppLauncher/ListApplications",
+		       grpc::StubOptions(), &request, &response,
+		       [&](grpc::Status status) {
+			       const std::lock_guard<std::mutex> lock(mutex);
+			       result = status;
+			       done = true;
+			       cond.notify_one();
+		       });
+
+	std::unique_lock<std::mutex> lock(mutex);
+	cond.wait(lock, [&] { return done; });
+
+	return result;
+}
+
+static double percentile(std::vector<double> &samples, double p)
+{
+	std::sort(samples.begin(), samples.end());
+	return samples[std::min<size_t>(samples.size() * p, samples.size() - 1)];
+}
+
+static bool run(const char *name, const std::string &target)
+{
+	std::vector<double> calls, connects;
+
+	{
+		grpc::GenericStub stub(grpc::CreateChannel(target, grpc::InsecureChannelCredentials()));
+
+		// Warm up the channel
+		if (!list_applications(stub).ok())
+			return false;
+
+		for (int i = 0; i < CALLS; i++) {
+			auto start = Clock::now();
+			list_applications(stub);
+			calls.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+		}
+	}
+
+	for (int i = 0; i < CONNECTIONS; i++) {
+		// Channels with the same arguments share their connection
+		grpc::ChannelArguments args;
+		args.SetInt("bench.connection", i);
+
+		auto start = Clock::now();
+		grpc::GenericStub stub(grpc::CreateCustomChannel(target, grpc::InsecureChannelCredentials(), args));
+		if (!list_applications(stub).ok())
+			return false;
+		connects.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+	}
+
+	printf("%-6s %10.1fus %10.1fus %12.1fus %12.1fus\n", name,
+	       percentile(calls, 0.5), percentile(calls, 0.99),
+	       percentile(connects, 0.5), percentile(connects, 0.99));
+
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	const gchar *app_ids[] = { "bench1", "bench2", "bench3", "bench4", "bench5", NULL };
+	std::string path = std::string(g_get_tmp_dir()) + "/bench-transport-" +
+		std::to_string(getpid()) + ".sock";
+
+	g_log_set_debug_enabled(FALSE);
+
+	FakeSystemd *fake = fake_systemd_new(app_ids);
+	SystemdManager *manager = systemd_manager_get_default();
+	AppLauncherImpl service(manager);
+
+	int port = 0;
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+	builder.RegisterService(&service);
+	std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+
+	PeerPolicy policy;
+	UnixListener listener(path, policy);
+	if (!listener.Listen())
+		return 1;
+	listener.Attach(server.get());
+
+	GMainLoop *loop = g_main_loop_new(NULL, FALSE);
+	std::thread loop_thread(g_main_loop_run, loop);
+
+	printf("%d calls, %d connections per transport\n", CALLS, CONNECTIONS);
+	printf("%-6s %12s %12s %14s %14s\n", "", "call p50", "call p99", "connect p50", "connect p99");
+
+	bool ok = run("tcp", "127.0.0.1:" + std::to_string(port)) &&
+		run("unix", "unix:" + path);
+
+	g_main_loop_quit(loop);
+	loop_thread.join();
+	g_main_loop_unref(loop);
+
+	server->Shutdown();
+	g_object_unref(manager);
+	fake_systemd_free(fake);
+
+	return ok ? 0 : 1;
+}